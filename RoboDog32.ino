@@ -16,6 +16,7 @@ void setup() {
 }
 
 void loop() {
+  PROFILE(PROF_LOOP);
   //  //— read environment sensors (low level)
   readEnvironment();  // update the gyro data
   //  //— special behaviors based on sensor events
@@ -0,0 +1,953 @@
+// Generated by tools/compressSkills.py from InstinctBittleESP.h. Do not edit.
+// number of skills: 93
+// 22425 -> 13744 bytes (61.3%)
+
+const int8_t bdF[] PROGMEM = {  // 300 -> 102 bytes
+  37, 0, 0, 1, 0, 56, 56, 72, 72, -21, -21, -35, -35, 0, 46, 46, 58, 58, 7, 7,
+  -4, -4, 32, -52, 52, 52, 9, 9, -117, 96, 48, -18, 64, 34, 34, -35, -52, 64, 17, 17,
+  -52, -52, 64, 34, 34, -35, -35, 64, 0, 17, -52, -52, 64, 34, 34, -35, -35, 64, 17, 17,
+  -35, -35, 64, 17, 34, -35, -52, 64, 17, 17, -35, -18, 64, 17, 34, -35, -52, 64, 17, 17,
+  -18, -35, 64, 17, 34, -52, -18, 64, 0, 17, -18, -52, 64, 34, 17, -35, -18, 96, -52, 17,
+  -18, -122,
+};
+const int8_t bk[] PROGMEM = {  // 348 -> 222 bytes
+  43, 0, 0, 1, 0, 38, 42, 36, 64, 2, -6, 3, -3, 64, 62, 30, 1, 16, 64, 62,
+  14, -16, 33, 64, 62, -2, 1, 33, 64, 46, -18, 1, 65, 64, 62, -19, 17, 19, 96, 83,
+  46, -15, 64, 14, -15, 33, -4, 64, 29, -14, 34, -2, 64, -18, -13, 65, -19, 64, -17, -31,
+  49, 14, 64, -3, -13, 2, -1, 64, 1, -28, -34, 15, 64, -31, -13, 13, 15, 64, -13, -29,
+  10, -16, 64, -31, -13, -16, 31, 64, -12, -29, 30, -16, 64, -29, -30, -2, 0, 64, -29, -13,
+  15, 1, 64, -12, -30, 14, 16, 64, -29, -30, 31, 1, 64, -29, -30, 15, 1, 64, -29, -30,
+  0, 17, 64, -29, -31, 31, 17, 64, -29, -32, 16, 19, 64, -30, -18, 16, 19, 64, -29, -18,
+  17, 20, 64, -30, -33, 16, 47, 64, -31, 47, 18, -33, 64, -31, 31, 16, -33, 64, -17, 63,
+  20, -49, 64, -33, 31, 34, 15, 64, -19, 78, 19, -48, 64, 0, 63, -2, -1, 64, 15, 63,
+  -17, -16, 64, 47, 62, -48, 15, 64, 62, 63, -49, -16, 64, 31, 62, -16, 0, 64, 78, 46,
+  -16, 0, 64, 62, 63, -48, 16, 64, 63, 46, -16, 0, 64, 62, 62, -16, 17, 64, 78, 46,
+  -15, 16,
+};
+const int8_t bkArmF[] PROGMEM = {  // 204 -> 131 bytes
+  25, 0, 0, 1, 0, 44, 49, 46, 67, -11, -20, -11, -20, 64, 46, 30, 1, 32, 64, 78,
+  -18, -16, 97, 64, 62, -18, 1, 47, 64, 29, -30, 33, 11, 64, 14, -28, 65, -2, 64, -34,
+  -29, 49, 14, 64, -32, -13, 12, -16, 64, -28, -28, 10, 15, 96, 15, -30, -29, 64, -28, -30,
+  30, 0, 64, -30, -29, 15, 1, 64, -28, -29, 15, 16, 64, -29, -31, 16, 2, 64, -28, -18,
+  15, 22, 64, -29, -18, 16, 2, 64, -47, 14, 18, -48, 64, -30, 78, 18, -65, 64, -19, 62,
+  21, -32, 64, 14, 63, -64, 15, 64, 78, 62, -96, -16, 96, 15, 46, 62, 64, 78, 62, -32,
+  0, 64, 46, 62, -15, 16, 64, 78, 62, -16, 1,
+};
+const int8_t bkArmL[] PROGMEM = {  // 204 -> 126 bytes
+  25, 0, 0, 1, 0, 42, 49, 46, 60, -12, -20, -11, -16, 96, 14, -30, 1, 64, 79, 14,
+  -15, 33, 96, 71, 63, -2, 96, 102, 33, -78, 64, 15, 4, 64, -2, 64, -33, -13, 49, 30,
+  64, -17, -13, 15, -16, 64, -30, 4, 14, 15, 96, 14, 62, 15, 64, -31, -14, 31, 0, 64,
+  -30, -13, 0, 1, 96, 7, -31, 3, 64, -31, -15, 31, 2, 64, -31, -2, 0, 6, 64, -31,
+  -18, 16, 34, 64, -47, 30, 16, -32, 64, -31, 46, 31, -1, 64, -17, 14, 19, 0, 96, 108,
+  31, -4, 64, 79, 30, -95, 0, 96, -114, -30, -15, 64, 79, 14, -32, 16, 64, 47, 30, -16,
+  0, 64, 64, 30, -16, 1,
+};
+const int8_t bkF[] PROGMEM = {  // 348 -> 222 bytes
+  43, 0, 0, 1, 0, 38, 42, 36, 64, 2, -6, 3, -3, 64, 62, 30, 1, 16, 64, 62,
+  14, -16, 33, 64, 62, -2, 1, 33, 64, 46, -18, 1, 65, 64, 62, -19, 17, 19, 96, 83,
+  46, -15, 64, 14, -15, 33, -4, 64, 29, -14, 34, -2, 64, -18, -13, 65, -19, 64, -17, -31,
+  49, 14, 64, -3, -13, 2, -1, 64, 1, -28, -34, 15, 64, -31, -13, 13, 15, 64, -13, -29,
+  10, -16, 64, -31, -13, -16, 31, 64, -12, -29, 30, -16, 64, -29, -30, -2, 0, 64, -29, -13,
+  15, 1, 64, -12, -30, 14, 16, 64, -29, -30, 31, 1, 64, -29, -30, 15, 1, 64, -29, -30,
+  0, 17, 64, -29, -31, 31, 17, 64, -29, -32, 16, 19, 64, -30, -18, 16, 19, 64, -29, -18,
+  17, 20, 64, -30, -33, 16, 47, 64, -31, 47, 18, -33, 64, -31, 31, 16, -33, 64, -17, 63,
+  20, -49, 64, -33, 31, 34, 15, 64, -19, 78, 19, -48, 64, 0, 63, -2, -1, 64, 15, 63,
+  -17, -16, 64, 47, 62, -48, 15, 64, 62, 63, -49, -16, 64, 31, 62, -16, 0, 64, 78, 46,
+  -16, 0, 64, 62, 63, -48, 16, 64, 63, 46, -16, 0, 64, 62, 62, -16, 17, 64, 78, 46,
+  -15, 16,
+};
+const int8_t bkL[] PROGMEM = {  // 388 -> 235 bytes
+  48, 0, 0, 1, 0, 47, 57, 49, 57, -5, -19, -2, -12, 64, 63, 30, 0, 16, 96, 39,
+  79, 30, 96, 14, -29, 2, 64, 63, 31, 16, 0, 64, 47, 29, 16, 17, 96, 46, -14, 33,
+  64, 15, 29, 49, 1, 64, 31, -1, 48, 33, 64, -48, -2, 80, 32, 64, -33, 13, 80, 33,
+  64, -33, -2, 48, -15, 64, -17, -2, 1, 34, 96, 54, -33, -2, 64, -2, -16, -15, -3, 64,
+  -14, -14, -2, 12, 64, -15, 3, -2, 11, 64, -30, 4, 14, 12, 64, -15, -13, -16, 13, 64,
+  -15, 4, -16, 15, 64, -31, -13, 15, 14, 64, -15, 5, -16, -1, 96, 71, -31, -12, 96, 15,
+  -31, -12, 96, 15, -15, -13, 96, 23, -31, -13, 64, -31, -12, 0, 1, 96, 15, -31, -13, 64,
+  -14, 3, 16, 1, 96, 71, -31, 18, 64, -47, -14, 16, 2, 96, 67, -15, 3, 64, -48, -15,
+  18, 3, 64, -17, -3, 17, 5, 64, -17, 13, 18, 5, 64, -32, -3, 16, 3, 64, -17, -18,
+  18, 0, 64, -32, 31, -16, -17, 64, 31, 31, -48, -17, 64, 48, 15, -96, -1, 64, 48, 47,
+  -64, -17, 64, 79, 30, -64, 0, 64, 47, 15, -32, 15, 64, 80, 31, -16, 15, 64, 79, 30,
+  -16, 0, 64, 79, 31, -16, 15, 96, 46, -28, -15, 96, 15, 63, 46,
+};
+const int8_t carpetF[] PROGMEM = {  // 516 -> 269 bytes
+  64, 0, 0, 1, 0, 45, 59, 47, 58, -10, -4, -5, -4, 96, 25, 18, 5, 96, 39, 19,
+  17, -128, 96, -114, 17, 17, 32, 1, 51, 96, -116, 33, 1, 96, -119, 97, 13, 96, -120, -75,
+  64, 16, 97, 16, -112, 96, -120, -92, 96, -116, 65, 8, 96, -117, 17, -81, 96, -120, -50, 64,
+  17, -80, 32, -48, 96, 38, 22, 14, 96, 34, -74, 96, 43, 81, -97, 64, 64, -111, -112, 16,
+  32, -85, 56, 91, 62, -29, -40, 96, -84, -127, 90, 96, -86, -82, 107, 32, -66, 84, 56, 44,
+  -4, -43, -21, 96, -120, 126, 96, -55, -15, 81, 96, -120, 66, 96, 11, -111, 2, 96, 38, 24,
+  3, 96, 34, 72, 96, 46, 26, 97, 96, 34, 122, 32, 43, 59, 46, 47, -15, 96, 34, 95,
+  96, 46, 18, 81, 96, 19, 49, 1, -128, 96, 77, 17, 17, 32, 2, 51, 96, 76, 18, 1,
+  96, 70, 97, 13, 96, 76, 21, 11, 96, 85, 97, -111, 96, 76, 20, 10, 96, 69, 65, 8,
+  96, 70, -15, 10, 96, 84, 30, 12, 64, 20, 11, 1, 13, 96, 25, 22, 12, 96, 17, -91,
+  64, 21, 31, 9, 0, 96, 85, -106, 24, 32, 95, 90, 56, 62, 55, -31, -40, 96, 85, -127,
+  90, 96, 85, -84, 108, 32, 125, 84, 44, 56, -43, -4, -21, 96, 68, 126, 96, -58, -15, 21,
+  96, 69, 45, 4, 64, 24, 18, 1, 0, 32, 17, 64, -39, 96, 25, 25, 6, 96, 21, 27,
+  7, 32, 17, 48, -18, 96, 23, 30, 97,
+};
+const int8_t carpetL[] PROGMEM = {  // 516 -> 240 bytes
+  64, 0, 0, 1, 0, 62, 59, 47, 58, -16, -4, -5, -15, 32, 16, -14, 96, 39, 17, 17,
+  -128, 96, 6, 17, -128, 96, -116, 33, 1, 96, -120, -30, 96, -120, -15, 64, 16, 17, 16, -16,
+  96, -103, 33, -63, 96, -124, -15, 96, -126, -31, 96, -120, -1, 96, -86, -15, -30, 96, 38, 22,
+  14, 96, 34, -74, 96, 35, 81, 9, 96, 46, 20, -98, 96, -86, -26, 40, 96, -84, -47, 26,
+  96, -86, -18, 43, 64, -80, -15, -48, 32, 96, -120, 78, 96, -56, 31, 1, 96, -120, 17, 96,
+  10, 25, 96, 38, 24, 3, 96, 34, 72, 96, 38, 26, 6, 96, 34, 122, 32, 51, 66, 46,
+  -12, -15, 96, 34, 95, 96, 38, 18, 5, 96, 10, 19, -128, 96, 68, 17, 32, 2, 51, 96,
+  69, 33, 1, 96, 70, 97, 13, 96, 68, -75, 96, 76, 22, 9, 96, 68, -92, 96, 68, -124,
+  96, 70, -15, 10, 96, 68, -50, 64, 17, 11, 1, 13, 96, 17, -13, 96, 25, 18, 13, 96,
+  23, 17, -1, 96, 85, -110, 28, 32, 86, 56, 62, -22, -40, 96, 84, -24, 5, 96, 85, -81,
+  111, 32, 116, 44, -26, -4, -21, 96, 76, 30, 7, 96, 70, -15, 5, 96, 68, 66, 96, 23,
+  29, 18, 96, 17, 29, 96, 17, 30, 96, 21, 30, 1, 96, 25, 31, 3, 96, 23, 30, 33,
+};
+const int8_t crArmF[] PROGMEM = {  // 540 -> 329 bytes
+  67, 0, 2, 1, 0, 39, 67, 80, 73, -39, -39, -45, -37, 64, 30, 30, 1, 0, 64, 45,
+  29, 1, 0, 64, 29, 47, 2, 0, 64, 31, 30, 2, 0, 64, 47, 29, 3, 16, 64, 16,
+  30, 17, 0, 96, 15, 17, 30, 64, 16, 29, 16, 16, 64, 33, 31, 16, 0, 64, 34, 30,
+  -33, 1, 64, 17, 28, -1, 18, 64, -14, 31, -48, 0, 64, -15, 28, -1, 18, 96, 89, 18,
+  31, 64, 1, 31, -16, 19, 64, -30, 17, 15, 1, 96, -109, -15, 31, 64, -46, 34, 0, 15,
+  64, -31, 33, 0, -32, 64, -30, 34, 15, -32, 64, -47, 17, 0, -17, 64, -30, -14, 15, -48,
+  96, 7, -15, 1, 96, 7, -46, 1, 64, -31, -14, 31, -16, 96, 15, -30, -15, 64, -47, -46,
+  16, -1, 64, -30, -15, 0, -16, 64, -15, -14, 15, 0, 64, -62, -31, 16, -16, 64, -31, -31,
+  16, 0, 64, -15, -15, 0, 1, 64, -46, -30, 32, -16, 96, 15, -31, -31, 64, -30, -31, 16,
+  0, 64, -47, -46, 16, 0, 64, -47, -15, 32, 0, 64, -14, -31, 32, 1, 64, -15, -47, 49,
+  0, 96, 45, 17, 30, 64, 17, -31, 1, 1, 96, 29, 18, 29, 64, 18, -15, 13, 0, 64,
+  33, -31, -1, 17, 64, 31, -63, -3, 32, 64, 47, -15, 15, 1, 64, 16, -63, -16, 32, 64,
+  32, 1, -1, 17, 64, 30, -15, 0, 48, 64, 47, 16, -16, 17, 96, 39, 29, -14, 64, 46,
+  34, 0, -2, 64, 30, 18, 0, 14, 64, 45, 33, -16, 14, 64, 30, 31, 0, -3, 96, 43,
+  47, -14, 96, 11, 29, 1, 64, 46, 31, 1, 15, 64, 30, 47, -16, 0, 64, 45, 29, 1,
+  15, 64, 30, 47, 0, -1, 96, 15, 47, 31, 64, 28, 46, -15, 15, 64, 46, 30, 1, 0,
+  96, 15, 31, 31, 64, 29, 30, 2, 31,
+};
+const int8_t crArmL[] PROGMEM = {  // 540 -> 279 bytes
+  67, 0, 2, 1, 0, 55, 67, 80, 70, -40, -39, -45, -39, 96, 6, -31, 96, 15, 46, 29,
+  96, 6, -15, 96, 23, 30, 30, 96, 30, -46, 17, 96, 38, -31, 1, 96, 6, -31, 96, 46,
+  -47, 18, 96, 38, -14, 1, 96, 102, -30, 29, 64, 18, 28, -16, 18, 96, 38, -1, 13, 96,
+  102, -49, 47, 96, 89, 17, 31, 96, 100, -1, 3, 96, 70, 30, 1, 96, 11, -14, 1, 64,
+  -48, 34, 0, -17, 96, 6, 30, 64, -31, 18, 0, -16, 96, 70, 29, 15, 96, 6, 46, 96,
+  23, -14, -15, 96, 6, 29, 96, 38, 46, 1, 96, 15, -31, -31, 96, 102, 45, -15, 96, 14,
+  30, 15, 96, 7, -14, 2, 96, 46, 28, 30, 96, 38, 30, 1, 64, -15, -15, 0, 1, 96,
+  38, 45, 2, 96, -114, 30, -1, 96, 39, -30, 17, 96, 38, 45, 1, 96, 46, 29, 46, 64,
+  -15, 1, 32, 1, 96, 46, 31, 63, 96, 36, 17, 64, 17, -31, 1, 1, 96, 5, 17, 64,
+  17, -15, 15, 0, 96, 102, 18, 31, 64, 17, -31, -2, 16, 64, 46, -15, 0, 1, 96, 38,
+  17, 15, 64, 32, -15, -16, 17, 96, 6, 17, 64, 47, 0, -16, 17, 96, 38, 33, 15, 64,
+  46, 2, 1, 14, 96, 70, 33, 14, 64, 47, 17, -16, 14, 96, 70, -15, 13, 96, 35, 46,
+  15, 96, 10, 17, 96, 71, 47, -1, 96, 38, -15, 15, 96, 78, -46, -14, 96, 71, 30, -1,
+  96, 6, -14, 64, 31, 30, -16, 15, 96, 6, -30, 96, 23, 30, 31, 96, 78, -31, -14,
+};
+const int8_t crF[] PROGMEM = {  // 828 -> 513 bytes
+  103, 0, 2, 1, 0, 35, 84, 85, 78, -43, -43, -52, -44, 64, 31, 30, 17, 0, 64, 44,
+  29, 1, 0, 64, 31, 30, 1, 16, 64, 29, 44, 18, 0, 64, 30, 30, 2, 0, 64, 31,
+  30, 17, 16, 64, 47, 45, 2, 0, 96, 44, 30, 1, 64, 16, 30, 1, 17, 64, 16, 28,
+  17, 0, 64, 16, 30, 1, 17, 64, 1, 44, 33, 1, 64, 17, 14, 15, 17, 96, 29, -31,
+  -15, 64, 34, 29, -1, 17, 64, 17, 30, -1, 1, 64, 34, 29, -32, 18, 64, 1, 14, -17,
+  17, 64, 2, 30, 15, 2, 64, 17, 31, -1, 17, 96, -93, -14, 31, 64, 1, 16, -17, 18,
+  64, -14, 16, 15, 1, 64, -30, 0, -16, 17, 64, -15, 1, -1, 16, 96, -117, -14, 17, 64,
+  -47, 18, -17, 30, 64, -14, 18, 0, -16, 64, -46, 17, -1, -1, 64, -31, 34, 0, -16, 64,
+  -14, 17, -1, -1, 64, -62, 18, 0, -32, 64, -31, 2, 0, -1, 64, -14, -15, 15, -16, 64,
+  -63, 34, 0, -1, 64, -30, -14, 0, -16, 64, -62, 1, 15, -16, 64, -14, -30, 0, -1, 96,
+  -121, -31, -15, 64, -62, -14, 16, -16, 64, -31, -30, 0, -1, 64, -62, 2, 16, -16, 64, -31,
+  -47, 0, -16, 64, -30, 2, 16, -16, 64, -62, -31, 16, 0, 64, -15, -30, 16, -16, 64, -30,
+  -15, 0, -32, 64, -63, -30, 16, 0, 64, -15, -46, 16, -16, 64, -63, -15, 17, 0, 64, -30,
+  -46, 16, -16, 64, -15, -31, 16, 0, 64, -63, -31, 17, 0, 64, -14, -47, 16, 1, 64, -47,
+  -30, 32, 0, 64, -31, -63, 33, 0, 64, -15, -31, 16, 1, 64, -15, -30, 33, 0, 96, 13,
+  18, 13, 64, 0, -31, 17, 1, 64, 1, -31, 16, 16, 64, 1, -63, 17, 1, 64, 17, -30,
+  16, 16, 64, 16, -64, -14, 17, 64, 17, -31, -16, 16, 64, 32, -31, -16, 1, 64, 18, -47,
+  -1, 16, 64, 33, -31, 15, 17, 64, 18, -48, -2, 33, 64, 32, -31, -2, 16, 64, 16, -31,
+  -16, 33, 64, 33, -16, 15, 17, 64, 31, 1, -1, 1, 64, 32, 1, -2, 32, 96, -61, 47,
+  17, 64, 30, 0, -1, 17, 64, 47, 17, 15, 1, 64, 31, 1, -16, 1, 64, 45, 33, 14,
+  -17, 64, 47, 33, -16, 15, 64, 29, 18, 15, -1, 64, 46, 33, -16, 15, 64, 47, 17, 15,
+  -2, 96, 75, 28, -14, 64, 46, 47, -16, -1, 64, 31, 18, 0, 15, 64, 44, 47, 0, -1,
+  64, 46, 32, -16, 15, 64, 44, 30, 0, 15, 64, 31, 32, 0, -1, 64, 46, 31, 0, 15,
+  64, 28, 46, 1, 15, 64, 46, 32, 0, -1, 64, 28, 45, 1, 15, 96, 75, 46, -15, 64,
+  46, 46, 1, 0, 64, 28, 30, 1, 15, 64, 47, 47, 1, 14, 96, 15, 30, 30, 64, 28,
+  45, 1, 15, 64, 31, 47, 17, 0, 64, 44, 29, 1, 15,
+};
+const int8_t crL[] PROGMEM = {  // 828 -> 436 bytes
+  103, 0, 2, 1, 0, 63, 84, 85, 70, -47, -43, -52, -45, 96, 38, -31, 1, 96, 15, 47,
+  45, 96, 6, -31, 96, 39, 30, 28, 96, 14, -31, 2, 96, 38, -31, 1, 96, 23, 46, 45,
+  96, 44, 30, 1, 96, 70, -31, 1, 96, 38, -63, 1, 96, 78, -31, 18, 64, 15, 12, 33,
+  1, 96, 70, -31, 1, 96, 12, 30, 96, 102, -46, 31, 64, 18, 14, -16, 1, 64, 32, 45,
+  -32, 2, 96, 100, -18, 1, 96, 85, -30, 47, 64, 16, 47, -16, 1, 96, 34, -1, 96, 97,
+  -31, 2, 96, 74, 31, 1, 96, 98, -2, 1, 96, 39, -14, -15, 96, -118, 31, 1, 96, 102,
+  45, -18, 96, 15, -15, 18, 64, -48, 33, -16, -1, 96, 6, 46, 64, -14, 1, -16, 15, 96,
+  -122, 44, 14, 96, 70, 46, 15, 96, 15, -14, -15, 96, 70, 44, 15, 96, 6, 46, 96, 7,
+  -63, 1, 96, 78, 47, -1, 96, 6, 30, 64, -62, -30, 16, 0, 96, 70, 46, 15, 64, -64,
+  -14, 16, -16, 96, 7, -30, 1, 96, 46, 46, 30, 96, 38, 28, 1, 64, -15, -14, 16, 0,
+  96, 6, 30, 96, 46, 44, 30, 96, 39, -14, 18, 96, 46, 28, 31, 96, 38, 46, 1, 64,
+  -15, -31, 16, 0, 96, 38, 28, 1, 96, 102, 31, 17, 64, -46, -30, 32, 0, 96, 38, 30,
+  2, 64, -16, -15, 16, 1, 96, 39, -14, 34, 96, 12, -47, 96, 100, 17, 1, 96, 45, 17,
+  31, 96, 100, 17, 1, 64, 16, -30, 16, 16, 64, 17, 0, -15, 1, 96, 46, 17, -2, 64,
+  33, 1, -16, 1, 96, 46, 17, -1, 96, 70, 18, 1, 64, 18, -32, -1, 1, 96, 38, 18,
+  15, 64, 16, 1, -16, 17, 64, 46, -32, 15, 17, 96, 102, 17, 31, 96, 38, 18, 15, 96,
+  -54, -14, 17, 96, 114, -15, 31, 96, 70, 18, 1, 64, 30, 1, -16, 1, 96, 70, 18, 15,
+  64, 47, 1, -1, 15, 96, 78, 33, -14, 64, 46, 1, -16, 15, 96, 70, 18, 14, 64, 31,
+  32, 0, -1, 96, 102, -14, -1, 96, 71, 30, -14, 96, 78, -14, -15, 96, 99, 47, -1, 96,
+  70, -30, 15, 96, 75, 30, -14, 96, 70, -14, 15, 96, 70, -31, 15, 96, 75, 46, -15, 96,
+  70, -47, 15, 96, 67, 47, 15, 96, 14, -30, 2, 96, 71, 29, -2, 96, 70, -14, 14, 96,
+  15, 31, 46, 96, 70, -47, 15, 64, 30, 15, 17, 0, 96, 78, -46, -15,
+};
+const int8_t gpF[] PROGMEM = {  // 732 -> 467 bytes
+  91, 0, 0, 1, 0, -14, 67, 68, 60, 20, -10, -24, -13, 64, 45, 59, 22, -1, 64, 29,
+  42, 20, 16, 0, -23, 71, 51, 66, 38, -7, -24, -12, 64, 17, 26, 17, 1, 64, 19, 43,
+  46, 18, 64, 16, 26, 16, 18, 64, 18, 25, 28, 20, 64, 19, 26, 28, 20, 64, 3, 43,
+  45, 19, 64, 3, 25, 45, 37, 64, 19, 10, 45, 22, 64, 2, 30, 46, 35, 64, 2, 29,
+  45, 21, 64, 3, 31, 61, 35, 64, 3, 15, 46, 37, 64, 2, 0, 46, 33, 64, -14, 2,
+  78, 47, 64, 35, 18, 14, 44, 64, 50, 3, -35, 46, 64, 34, 2, -49, 45, 64, 35, -13,
+  -34, 63, 64, 18, 2, -65, 61, 64, 19, 2, -50, 62, 64, 2, -13, -65, 46, 64, -14, 2,
+  -49, 79, 64, -13, -13, -50, 62, 64, -30, -14, -49, 63, 64, -62, -14, -33, 94, 64, -30, 2,
+  -32, 47, 64, -61, 35, -17, -1, 64, -78, 66, -1, -82, 64, -62, 51, -16, -65, 64, -94, 34,
+  15, -65, 64, -78, 18, -15, -32, 64, -94, 18, 32, -81, 64, -94, 18, 16, -97, 64, -94, 19,
+  48, -112, 64, -94, -14, 48, -65, 64, -110, 2, 64, -64, 64, -78, -30, 48, -80, 64, -95, -14,
+  81, -64, 64, -95, -46, 80, -48, 64, -93, -46, 97, -48, 64, -95, -62, 96, -32, 64, -95, -63,
+  113, -16, 64, -30, -93, 49, 15, 64, -47, -94, 97, 1, 64, -47, -63, 65, 1, 64, -31, -95,
+  113, 16, 64, 33, -110, 2, 33, 64, 33, -95, -31, 33, 64, 17, -79, -31, 49, 64, 49, -95,
+  -63, 49, 64, 48, -110, -46, 65, 64, 32, -95, -62, 82, 64, 49, -96, -46, 81, 64, 48, -63,
+  -30, 82, 64, 32, -47, -46, 65, 64, 32, -31, -29, 66, 64, 48, -16, -46, 66, 64, 48, -16,
+  -30, 50, 64, 47, 48, -28, -14, 64, 50, 17, -32, -30, 64, 35, 32, -19, -46, 64, 34, 48,
+  -20, -46, 64, 50, 47, -19, -29, 64, 33, 48, -21, -29, 64, 33, 32, -4, -13, 64, 48, 63,
+  -5, -46, 64, 47, 32, -20, -12, 64, 63, 47, -4, -29, 64, 46, 63, -4, -29, 64, 44, 47,
+  -3, -11, 64, 46, 48, -2, -30, 64, 60, 34, -2, -1, 64, 43, 36, -1, -6, 64, 44, 35,
+  15, -5, 64, 42, 50, -16, -5, 64, 59, 33, 15, -2, 64, 26, 33, 18, -6, 64, 42, 33,
+  1, 9, 64, 42, 49, 3, -7, 64, 42, 47, 3, 11, 64, 41, 32, 4, -4, 64, 43, 46,
+  3, 11, 64, 26, 47, 5, 12, 64, 42, 45, 21, 13, 64, 42, 45, 6, 13, 64, 26, 44,
+  22, 14, 64, 42, 44, 23, 15,
+};
+const int8_t gpL[] PROGMEM = {  // 772 -> 498 bytes
+  96, 0, 0, 1, 0, 29, 67, 70, 41, -15, -10, -26, -13, 64, 46, 28, 17, 0, 64, 30,
+  26, 18, 0, 64, 31, 42, 18, -16, 64, 16, 26, 17, 1, 64, 31, 43, 36, 2, 64, 18,
+  41, 30, 2, 64, 17, 26, 31, -13, 64, 18, 26, 16, 4, 64, 2, 43, 47, 3, 64, 1,
+  25, 47, 5, 64, 17, 26, 47, 5, 64, 3, 42, 47, 7, 64, 1, 29, 32, 3, 64, 1,
+  29, 48, 21, 64, 2, 31, 47, 4, 64, 1, 30, 47, 5, 96, 105, 18, 51, 64, -30, 35,
+  79, 29, 96, 101, 49, -60, 64, 65, 18, -64, 30, 64, 34, 18, -33, 13, 64, 49, 19, -96,
+  29, 64, 34, 18, -64, 14, 64, 17, 19, -64, 30, 64, 34, 18, -96, 15, 64, -15, 3, -80,
+  29, 64, -14, 18, -80, 31, 64, -31, 18, -49, 14, 64, -32, 19, -47, 30, 64, -30, 18, -48,
+  47, 64, -63, 19, -48, -2, 64, -63, 50, -32, -33, 64, -62, 18, -15, -1, 64, -79, 34, 0,
+  -33, 64, -95, -13, 0, -17, 64, -96, 18, 3, -17, 64, -79, -30, 0, -17, 64, -96, -30, 32,
+  -16, 64, -110, -29, 49, -17, 64, -95, -30, 48, -16, 64, -96, -46, 49, -1, 64, -95, -62, 81,
+  -16, 64, -95, -46, 80, 0, 64, -112, -62, 81, 0, 64, -62, -46, 81, 0, 64, -112, -46, 113,
+  0, 64, -95, -62, 113, 16, 0, 75, -21, 61, 44, -4, 28, -12, -21, 64, -47, -45, 81, 31,
+  64, -48, -63, 97, 16, 0, 77, -32, 67, 33, -1, 48, -12, -17, 64, -16, -63, 65, 33, 64,
+  17, -46, 17, 32, 64, 48, -79, -30, 49, 64, 48, -63, -96, 49, 64, 64, -63, -62, 33, 64,
+  48, -63, -62, 50, 64, 33, -47, -63, 65, 64, 48, -63, -63, 50, 64, 48, -79, -46, 97, 64,
+  48, -16, -47, 34, 64, 48, -47, -47, 66, 64, 47, -32, -29, 49, 64, 32, 0, -47, 51, 64,
+  48, 17, -46, 2, 64, 62, 16, -28, 2, 64, 34, 32, -32, -46, 64, 33, 16, -32, -13, 64,
+  50, 47, -19, -46, 64, 34, 16, -35, -13, 64, 33, 16, -3, -13, 64, 49, 63, -19, -45, 64,
+  33, 47, -5, -12, 64, 48, 31, -20, -13, 64, 32, 32, -3, -28, 64, 32, 30, -3, -12, 64,
+  63, 47, -19, -12, 64, 47, 46, -3, -26, 64, 47, 16, -2, -30, 64, 46, 18, 13, 15, 64,
+  63, 51, -1, -20, 0, 78, 42, 80, 19, -18, -13, 39, -2, 64, 46, 20, 14, -7, 64, 44,
+  33, 30, -4, 64, 46, 34, -16, -7, 64, 45, 18, 15, 8, 64, 45, 33, 0, -23, 64, 45,
+  16, 15, 10, 64, 44, 32, 0, -5, 64, 44, 47, 1, -5, 64, 44, 30, 0, -4, 64, 28,
+  30, 17, 12, 64, 29, 46, 1, -3, 64, 60, 29, 18, 14, 64, 28, 43, 1, -2,
+};
+const int8_t hlw[] PROGMEM = {  // 220 -> 156 bytes
+  27, 0, 0, 1, 0, 14, 32, 54, 48, 27, 24, 0, 12, 32, 31, 9, 34, 49, 49, 38,
+  64, 20, 29, 11, 16, 64, 34, 43, 31, 2, 0, 17, 38, 35, 52, 31, 26, 10, 14, 64,
+  66, 32, -66, 19, 64, 33, 2, -96, 30, 64, -30, 18, -1, 16, 64, -46, 18, 15, 31, 64,
+  -78, 81, 31, -96, 64, -46, 18, 31, -95, 64, -79, -31, 17, -16, 64, -62, -30, 46, -48, 64,
+  -79, -47, 80, -15, 32, -81, 34, 10, 49, 51, 33, 0, 64, 1, -47, 64, 1, 64, 66, -62,
+  -79, 0, 64, 33, -96, -15, 65, 0, 42, 18, 54, 34, 21, 30, 15, 13, 64, 34, 32, -6,
+  -31, 64, 46, 33, -1, 1, 64, 29, 17, -16, 1, 64, 43, 37, 1, -6, 64, 45, 33, -15,
+  26, 64, 27, 30, 1, 15, 64, 44, 46, -14, 13, 64, 43, 29, -11, 15,
+};
+const int8_t jpF[] PROGMEM = {  // 244 -> 203 bytes
+  30, 0, 0, 1, 0, 55, 55, 78, 78, -20, -20, -7, -7, 0, 59, 59, 70, 70, -7, -7,
+  -11, -11, 0, 62, 62, 63, 63, 5, 5, -15, -15, 0, 66, 66, 55, 55, 18, 18, -20, -20,
+  0, 60, 60, 43, 43, 30, 30, -15, -15, 0, 54, 54, 30, 30, 42, 42, -11, -11, 0, 48,
+  48, 18, 18, 54, 54, -7, -7, 32, 51, 58, 58, 33, 33, 32, 51, 68, 68, 13, 13, 32,
+  51, 78, 78, -7, -7, 96, 51, -120, -52, 96, 51, -103, -52, 96, 51, -120, -69, 0, 43, 43,
+  25, 25, -15, -15, -10, -10, 0, 30, 30, 32, 32, -11, -11, -14, -14, 0, 18, 18, 38, 38,
+  -7, -7, -17, -17, 96, -52, 102, -1, 96, -52, 85, -1, 96, -52, 102, -1, -126, 0, 25, 25,
+  59, 59, -10, -10, -7, -7, 0, 32, 32, 62, 62, -14, -14, 5, 5, 0, 38, 38, 66, 66,
+  -17, -17, 18, 18, 0, 44, 44, 60, 60, -18, -18, 30, 30, 0, 49, 49, 54, 54, -19, -19,
+  42, 42, 0, 55, 55, 48, 48, -20, -20, 54, 54, 32, -52, 58, 58, 33, 33, 32, -52, 68,
+  68, 13, 13,
+};
+const int8_t lftF[] PROGMEM = {  // 452 -> 284 bytes
+  56, 0, 0, 1, 0, -1, 25, 43, 42, 45, 24, -9, -6, 64, 15, 46, 2, -32, 64, 29,
+  29, 3, 1, 64, 16, 14, -13, 1, 64, 47, 45, -29, 3, 64, 18, 28, 12, -15, 64, 17,
+  30, 14, 1, 96, 85, -30, 62, 64, 17, 47, -1, 1, 64, 18, 30, 14, -14, 64, 17, 31,
+  15, 1, 64, 18, 17, 13, 0, 64, 33, 18, -49, 14, 64, -14, 17, 15, 15, 96, 30, 31,
+  -15, 64, -31, 18, 16, 15, 64, -15, 16, 15, 15, 64, -46, 2, 31, 31, 64, -46, 17, 44,
+  0, 64, -15, 17, 16, -48, 64, -47, 2, 31, 14, 64, -47, -15, 48, -1, 64, -31, -16, 47,
+  0, 64, -47, -31, 47, 0, 64, -31, -46, 32, 15, 64, -46, -47, 61, 16, 64, -63, -31, 64,
+  0, 64, -32, -47, 47, 31, 64, -62, -47, 95, 32, 64, -16, -30, 32, 14, 64, -47, -47, 48,
+  16, 64, 1, -32, 63, 16, 64, -14, -46, 62, 48, 64, 33, -63, -64, 31, 64, 17, -31, -32,
+  16, 96, -86, -30, 62, 64, 17, -14, -1, 16, 64, 33, -31, -32, 47, 64, 17, -15, -16, 16,
+  64, 33, 17, -48, 0, 64, 18, 33, -4, -32, 64, 47, 17, -16, -16, 96, 45, 31, -15, 64,
+  30, 33, 1, -16, 64, 31, 1, -16, -16, 64, 45, 32, -15, -15, 64, 45, 17, -62, 0, 64,
+  31, 17, 1, 13, 64, 29, 32, -15, -32, 64, 29, 31, 3, -1, 64, 30, 15, -14, 0, 64,
+  29, 30, -14, 0, 64, 30, 45, 2, -16, 64, 45, 29, -45, 1, 64, 28, 30, 4, 0, 64,
+  14, 29, -14, -15,
+};
+const int8_t lftL[] PROGMEM = {  // 452 -> 248 bytes
+  56, 0, 0, 1, 0, 15, 25, 43, 39, 32, 24, -9, -7, 32, 4, 41, 96, 71, 31, 29,
+  64, 16, 46, -16, 1, 96, 102, -46, 62, 96, 70, -63, 1, 64, 16, 30, 0, -15, 96, 85,
+  -30, 62, 96, 102, -15, 31, 96, 70, -31, 2, 64, 17, 15, 15, 1, 96, 6, 17, 64, 32,
+  34, -64, 14, 64, -15, 1, 15, 15, 96, 6, 31, 64, -32, 18, 16, 15, 96, 67, -15, 15,
+  96, 102, 45, -15, 96, 38, 29, 2, 64, -15, 1, 31, 0, 64, -48, 18, 16, -18, 64, -47,
+  1, 48, 15, 96, 34, 46, 96, 46, 29, 47, 64, -31, -14, 47, 31, 96, 46, 29, 63, 96,
+  46, 28, 79, 64, -31, 1, 32, 15, 96, 46, 28, 95, 64, -16, -30, 32, 46, 64, -48, -15,
+  63, 16, 96, 40, 63, 96, 38, 47, 3, 64, 34, -15, -49, 15, 64, 16, -15, -32, 16, 96,
+  -86, -14, 46, 96, 38, 33, 15, 64, 32, -31, -32, 15, 96, 39, 17, -15, 96, 38, 18, 13,
+  96, 38, 17, 15, 64, 33, 1, -2, 0, 96, -84, 33, -17, 96, 6, 17, 96, 39, 31, -15,
+  96, 106, 18, 31, 64, 47, 1, -63, 0, 96, 71, 31, -47, 96, -86, 17, -1, 96, 71, 31,
+  -1, 64, 30, 15, -12, 0, 64, 31, 30, -16, 0, 96, 23, 31, 29, 96, 102, -46, 29, 96,
+  15, 31, 30, 64, 15, 13, -15, 1,
+};
+const int8_t phF[] PROGMEM = {  // 348 -> 197 bytes
+  43, 0, 15, 1, 0, -44, -45, 57, 48, 9, 6, -10, 4, 96, -52, 28, 46, 96, 76, 59,
+  15, 96, -124, 58, 96, -52, 43, 17, 96, -52, 26, 49, 64, -16, 28, 48, 34, 64, -16, 12,
+  32, 52, 64, 0, 28, 16, 38, 64, 0, -1, 16, 85, 64, 32, 17, -32, 63, 64, 1, -12,
+  14, 94, 96, -107, 49, 62, 64, 15, 67, 0, -81, 64, 15, 67, 2, -97, 64, 15, 51, 15,
+  -81, 96, -60, 18, 13, 96, -60, -13, 9, 96, -52, -14, -79, 96, -116, -30, 11, 96, -52, -46,
+  -62, 64, 16, -30, -32, -47, 96, -52, -79, -30, 96, -116, -61, 15, 96, 72, 58, 96, 76, -78,
+  1, 96, -52, -95, 19, 64, 15, -79, 3, 34, 64, 15, -64, 2, 67, 96, -52, -47, 66, 64,
+  0, -33, 2, 101, 64, 2, 17, 14, 19, 64, 16, 63, -32, -11, 64, 16, 48, -32, -29, 96,
+  78, 79, -93, 64, -16, 52, 32, -7, 64, -16, 51, -16, 10, 96, -56, -46, 15, 96, -56, -109,
+  1, 96, -52, 63, -5, 96, -52, 46, 27, 96, 76, 45, 12, 96, -52, 46, 45,
+};
+const int8_t phL[] PROGMEM = {  // 260 -> 143 bytes
+  32, 5, 15, 1, 0, -45, -44, 57, 44, 9, 7, -10, 1, 96, 76, 26, 14, 96, 76, 25,
+  15, 96, -52, 41, 17, 32, -18, -46, 28, 49, 9, -10, 1, 96, -52, -4, 52, 96, 108, 43,
+  114, 96, -54, 17, -12, 96, -60, -13, 1, 96, -52, 20, 31, 96, 68, -28, 96, -116, 52, 12,
+  96, 12, -13, 96, -52, -12, -33, 96, 76, -29, 1, 96, -60, 34, 14, 96, 12, -45, 96, -52,
+  -14, -13, 96, 76, -47, 3, 96, -52, -13, -15, 96, -52, -47, 20, 96, -56, 78, 2, 96, -52,
+  -31, 19, 96, -56, 111, 2, 96, 102, -15, 110, 96, -52, 49, -14, 32, 110, -43, 63, 39, 6,
+  26, 32, 102, -44, 67, 7, 17, 96, -56, -78, 1, 96, 76, 31, 8, 96, 76, 30, 9, 96,
+  76, 29, 12,
+};
+const int8_t trArmF[] PROGMEM = {  // 452 -> 283 bytes
+  56, 0, 0, 1, 0, 26, 32, 52, 58, 11, 1, 9, 1, 64, -77, -30, 47, -63, 64, -93,
+  -62, 47, 1, 64, -93, -63, 95, -14, 64, -63, -64, 49, 20, 64, -93, -79, 80, 2, 64, -94,
+  -79, 96, 34, 64, -77, -63, 80, 35, 96, 99, -14, 50, 64, -30, -16, 16, 19, 64, -30, -32,
+  65, 19, 64, 2, -16, 1, 21, 64, -32, 13, 67, 38, 64, -14, -14, 46, 47, 96, -72, 31,
+  18, 64, 1, 1, 30, 46, 64, 2, 18, 14, -2, 64, 49, 17, -49, 13, 64, 64, 66, -51,
+  -20, 96, -86, 36, -5, 64, 64, 50, -51, -3, 96, 106, 52, -3, 64, 63, 50, -35, -8, 64,
+  76, 63, -33, 12, 64, 44, 31, -16, 43, 64, 76, 47, -32, 13, 64, 60, 46, -31, 29, 64,
+  58, 45, -31, 13, 64, 61, 45, -15, 31, 64, 59, 46, -14, 28, 64, 58, 28, -14, 32, 64,
+  42, 44, -11, 47, 64, 44, 12, 19, 49, 64, 58, 27, 5, 32, 64, 42, 11, 6, 50, 64,
+  59, 28, 5, 34, 96, -109, 47, 66, 64, 46, 15, 17, 49, 64, 46, 14, 4, 81, 64, 16,
+  -1, 16, 65, 64, 14, -32, 52, 66, 64, 47, 47, -30, -14, 64, 16, 31, -14, -31, 64, 32,
+  32, -31, -30, 64, 16, 17, -16, -33, 64, -13, 1, -4, 0, 64, 20, 36, -20, -50, 64, 20,
+  34, -21, -33, 64, -12, 3, -4, 15, 64, 4, 19, -3, -80, 64, -45, 3, -19, -65, 64, -44,
+  3, -3, -80, 64, -62, -15, 15, -62, 64, -76, -30, 14, -64, 64, -61, -30, 30, -47, 64, -61,
+  -46, 30, -16,
+};
+const int8_t trArmL[] PROGMEM = {  // 452 -> 269 bytes
+  56, 0, 0, 1, 0, 32, 32, 52, 52, 7, 1, 9, 2, 64, -78, 2, 32, 1, 64, -96,
+  -30, 32, -15, 64, -95, -15, 95, 2, 64, -63, -16, 48, 20, 64, -95, -31, 80, -14, 64, -95,
+  -15, 96, 2, 64, -79, -15, 80, 3, 64, -15, 0, 47, 3, 64, -31, -16, 16, 3, 96, 99,
+  -31, 52, 96, 65, 81, 64, -17, -3, 66, 38, 96, 102, 47, -14, 96, 33, 33, 64, 1, -15,
+  30, 46, 96, 68, -30, 96, 102, 19, -36, 64, 65, 18, -50, 12, 96, 42, 20, 11, 64, 79,
+  18, -64, 13, 96, 98, -44, 15, 64, 48, 18, -34, 8, 64, 79, 31, -48, 12, 64, 47, 31,
+  -16, 11, 64, 78, 15, -31, 13, 64, 63, 30, -32, 13, 64, 62, 29, -32, 29, 64, 62, 13,
+  -15, 15, 64, 63, 30, -16, 12, 64, 62, 28, -15, 0, 64, 47, 28, -15, 15, 64, 46, 12,
+  17, 17, 64, 62, 27, 1, 0, 64, 47, 27, 0, 2, 64, 62, 12, 1, 18, 96, 10, 18,
+  64, 32, 31, 16, 1, 96, -58, -30, 17, 64, 31, 31, 17, 1, 64, 15, -16, 50, 34, 96,
+  102, -14, 46, 96, 102, -15, 31, 64, 47, 16, -31, -14, 96, 102, 17, -1, 96, 38, 31, 15,
+  64, 17, 20, -32, -18, 64, 18, 2, -17, 15, 64, -15, 3, -1, 15, 96, 37, 49, 15, 64,
+  -48, 3, -32, -33, 64, -46, 3, -1, 0, 64, -64, -15, 0, -30, 64, -78, -14, 15, 0, 64,
+  -63, -30, 16, 1, 64, -64, -14, 16, -16,
+};
+const int8_t trF[] PROGMEM = {  // 388 -> 244 bytes
+  48, 0, 0, 1, 0, 31, 35, 55, 61, 9, 0, 11, 2, 64, -45, -14, 15, -47, 64, -78,
+  -63, 48, -30, 64, -93, -63, 47, 2, 64, -62, -48, 66, -12, 64, -94, -80, 64, 19, 64, -94,
+  -79, 80, 3, 64, -14, -16, 16, 19, 64, -30, -32, 49, 35, 64, -14, 0, 17, 5, 64, -31,
+  -3, 51, 39, 64, -14, -14, 62, 31, 96, -72, 31, 49, 64, 17, -15, 30, 30, 64, 3, 35,
+  13, 11, 64, 48, 34, -51, -3, 96, 106, 52, -3, 64, 49, 50, -34, -3, 64, 79, 32, -33,
+  15, 64, 63, 50, -19, 8, 64, 60, 47, -33, 28, 64, 44, 31, 16, 43, 64, 76, 47, -32,
+  29, 64, 60, 46, -31, 29, 64, 58, 29, -15, 29, 64, 61, 47, -16, 29, 64, 43, 28, 3,
+  46, 64, 58, 28, -14, 32, 64, 44, 13, 36, 79, 64, 42, 11, 4, 49, 64, 42, 27, 5,
+  48, 64, 47, 15, 1, 49, 64, 46, 14, 19, 50, 64, 47, 0, 17, 80, 64, 30, -33, 51,
+  114, 64, 47, 47, -29, -15, 96, 116, 31, 49, 64, 17, 31, -31, -31, 64, 48, 50, -48, -80,
+  64, 3, 34, -36, -33, 96, -107, 52, -3, 64, 19, 35, -19, -33, 64, -12, 2, -3, -16, 64,
+  -13, 35, -34, -128, 64, -61, -14, -3, -63, 64, -62, -15, 1, -78, 64, -60, -14, 14, -47, 64,
+  -61, -30, 30, -47,
+};
+const int8_t trL[] PROGMEM = {  // 340 -> 208 bytes
+  42, 0, 0, 1, 0, 35, 35, 55, 57, 6, -1, 10, 3, 64, -79, -15, 32, 2, 64, -63,
+  -30, 32, 2, 64, -95, -15, 48, -14, 64, -79, -15, 64, 1, 64, -79, -16, 79, 3, 64, -15,
+  1, 16, 3, 64, -31, -16, 32, -13, 64, -31, -16, 48, 36, 64, 15, 15, 34, 3, 64, -14,
+  0, 46, 3, 64, -16, -15, 32, 46, 96, 102, 33, -31, 64, 64, 18, -48, 27, 64, 49, 2,
+  -34, 13, 64, 63, 16, -48, 15, 64, 64, 17, -32, 13, 64, 48, 16, -18, 10, 64, 63, 15,
+  -32, 29, 64, 62, 30, -15, 13, 64, 63, 31, -16, 13, 64, 62, 14, -16, 27, 64, 47, 29,
+  -16, 14, 64, 62, 29, -15, 15, 64, 62, 12, 1, 16, 64, 47, 28, 0, 15, 64, 62, 12,
+  1, 17, 96, 14, -14, 1, 64, 32, 14, 16, 18, 64, 30, -1, 35, 33, 96, 100, 30, 2,
+  64, 16, 31, -32, -30, 96, 114, 18, 46, 96, 102, -15, 46, 64, 0, 35, -32, -17, 96, 53,
+  50, -17, 96, 5, 33, 96, -90, 62, -19, 64, -63, -15, 15, -15, 96, 7, -62, 3, 64, -64,
+  -15, 16, -15, 64, -95, -14, 31, -15,
+};
+const int8_t vtArmF[] PROGMEM = {  // 196 -> 77 bytes
+  24, 0, 0, 1, 0, 39, 33, 54, 47, 1, 13, 1, 13, 96, 85, -52, 119, 96, 85, -34,
+  85, -126, 96, -86, 67, -103, 96, -86, 67, -103, 96, -86, 67, -103, 96, -86, 51, -52, -128, 96,
+  -86, -51, 102, 96, -86, -51, 119, 96, -86, -52, 119, 96, -86, -34, 85, -126, 96, 85, 67, -103,
+  96, 85, 67, -103, 96, 85, 67, -103, 96, 85, 51, -52, -128, 96, 85, -51, 102,
+};
+const int8_t vtF[] PROGMEM = {  // 300 -> 152 bytes
+  37, 0, 0, 1, 0, 48, 39, 63, 52, -10, 7, -8, 9, 96, 85, -18, 52, 96, 85, -18,
+  51, 96, 85, -17, 67, 96, 85, -18, 51, 64, 46, 61, -60, -60, 96, -86, 34, -35, 96, -86,
+  33, -51, 96, -86, 34, -35, 96, -86, 34, -36, 96, -86, 33, -35, 96, -86, 34, -35, 96, -86,
+  33, -35, 96, -86, 49, -35, -128, 96, -86, -33, 51, 96, -86, -17, 51, 96, -86, -18, 51, 96,
+  -86, -17, 51, 96, -86, -18, 52, 96, -86, -18, 51, 96, -86, -17, 67, 96, -86, -18, 51, 96,
+  -86, -34, 68, 96, 85, 50, -52, 96, 85, 34, -35, 96, 85, 33, -51, 96, 85, 34, -35, 96,
+  85, 34, -36, 96, 85, 33, -35, 96, 85, 34, -35, 96, 85, 33, -35, 96, 85, 49, -35, -128,
+  96, 85, -33, 51, 96, 85, -17, 51, 96, 85, -18, 51,
+};
+const int8_t vtL[] PROGMEM = {  // 580 -> 345 bytes
+  72, 0, 0, 1, 0, 29, 26, 29, 26, 27, 22, 27, 22, 96, -91, 31, 47, 64, 15, -15,
+  17, 17, 64, 15, -14, 17, 18, 64, -16, -16, 17, 16, 96, 100, 18, 1, 96, 53, 31, -15,
+  64, 15, 17, -31, -1, 96, 85, 31, -31, 64, 15, 33, -31, -18, 64, -18, 50, 17, -50, 64,
+  -33, 34, 34, -48, 64, -34, 48, 66, -48, 64, -64, 49, 64, -32, 64, -17, 34, 66, 16, 64,
+  -2, 48, 49, 48, 32, 1, 13, 64, 14, 47, 31, 79, 64, 15, 31, 31, 61, 64, 16, 30,
+  31, 28, 96, 50, -14, 1, 96, 70, -47, 13, 64, 33, -18, -3, 15, 64, 18, -3, -20, 2,
+  96, 85, -44, 60, 64, 35, -18, -20, 3, 64, 19, -19, -18, 36, 64, 34, -2, -1, 34, 64,
+  16, -16, -14, 32, 64, 16, -1, -16, 17, 96, 58, -15, -14, 64, 16, -32, -15, -16, 96, 84,
+  -15, 15, 64, 1, -31, -1, -17, 64, 16, -15, -1, -1, 64, 16, -16, -1, 14, 96, 90, -15,
+  -15, 64, 16, -16, 2, 17, 64, 31, -16, 17, 17, 64, 47, 15, 33, 17, 96, 81, 31, 1,
+  64, 32, -16, 16, 31, 96, -54, -15, 30, 64, 17, -16, -1, 16, 64, 16, -16, -32, 30, 64,
+  18, -18, -18, 17, 64, 35, -3, -20, 34, 64, 34, -19, 13, 36, 96, 85, -61, 77, 64, 19,
+  -2, 14, 36, 64, 34, -17, 1, 19, 96, 25, -13, 3, 96, -56, 30, 15, 64, -14, -16, -12,
+  -15, 64, -15, 1, -45, -15, 64, -31, 2, -63, -15, 32, 4, 14, 64, -48, 18, -48, -33, 64,
+  -18, 33, -16, -50, 64, -33, 64, 32, -64, 64, -48, 50, 48, -50, 64, -18, 49, 48, -18, 64,
+  -34, 34, 66, -1, 64, -17, 1, 34, 47, 96, 85, 31, -14, 64, -1, 1, 17, 47, 96, -59,
+  31, 31, 96, -111, -2, 15, 64, 16, 16, -16, -1, 64, 30, 1, -2, -1, 64, 31, 1, -1,
+  -1, 96, -91, 31, 30,
+};
+const int8_t wkArmF[] PROGMEM = {  // 348 -> 223 bytes
+  43, 0, 0, 1, 0, 3, 40, 60, 56, 18, 2, -3, 3, 64, 45, 44, -10, -1, 64, 32,
+  28, 1, 31, 64, 18, 28, 14, 32, 64, 34, 28, 15, 0, 64, 34, 26, 13, 19, 64, 19,
+  29, 14, 34, 64, 34, 31, 31, 19, 64, 2, 17, 46, 34, 64, 35, 1, -34, 30, 64, 18,
+  18, -49, 47, 64, -14, 2, -18, 16, 64, -62, 18, 15, 47, 64, -62, 2, 14, 32, 64, -78,
+  17, 31, 0, 64, -77, 50, 31, -80, 64, -63, 18, 1, -32, 64, -78, -15, 47, -64, 64, -94,
+  -14, 79, -79, 64, -94, -31, 64, -48, 64, -62, -47, 79, -31, 64, -94, -46, 80, -32, 64, -46,
+  -62, 79, 15, 64, -46, -47, 96, -15, 64, 17, -63, -16, 2, 64, 50, -79, -48, 0, 64, 34,
+  -79, -32, 17, 64, 49, -63, -32, 34, 64, 34, -47, -31, 81, 64, 32, 17, -30, 34, 64, 34,
+  0, -3, 1, 64, 49, 33, -20, -46, 64, 47, 32, -2, 1, 64, 44, 33, -16, 2, 64, 60,
+  32, -32, -14, 64, 43, 17, -15, 0, 64, 43, 35, -15, 11, 64, 28, 33, 16, 30, 64, 43,
+  31, -14, -4, 64, 42, 47, -12, 27, 64, 42, 30, -12, 13, 64, 44, 45, -12, 14, 64, 42,
+  29, 5, 30,
+};
+const int8_t wkArmL[] PROGMEM = {  // 348 -> 209 bytes
+  43, 0, 0, 1, 0, 26, 40, 60, 54, 4, 2, -3, 1, 96, 102, -62, -1, 64, 32, 28,
+  2, 15, 96, 6, -63, 96, 6, -62, 64, 32, 26, 15, 3, 64, 18, 29, 0, 18, 96, 102,
+  -14, 49, 64, 1, 17, 47, 2, 64, 33, 1, -33, 14, 96, 102, 33, -4, 64, -15, 18, -32,
+  16, 96, 71, -63, -14, 96, -114, 44, 17, 64, -79, 1, 31, 0, 64, -79, 18, 16, -32, 96,
+  14, 44, 15, 64, -79, 1, 32, -16, 64, -95, -30, 79, 1, 96, -90, 26, -12, 64, -63, -15,
+  64, -15, 64, -95, -14, 80, 0, 64, -48, -30, 64, 15, 64, -47, 1, 96, 1, 64, 17, -31,
+  -1, -14, 96, 46, 19, -33, 64, 33, -31, -32, 1, 64, 49, 1, -32, 2, 64, 32, -31, -32,
+  33, 64, 32, -15, -31, 18, 64, 33, 0, -1, 1, 64, 48, 33, -18, -14, 96, 98, -14, 1,
+  64, 47, 17, -16, 2, 64, 61, 0, -31, 2, 96, 38, 18, 15, 64, 45, 19, -15, 11, 64,
+  31, 17, 16, 14, 64, 47, 15, -15, 12, 64, 46, 31, -16, 11, 64, 46, 14, -15, 13, 64,
+  46, 13, -15, 14, 64, 46, 45, 1, 14,
+};
+const int8_t wkF[] PROGMEM = {  // 932 -> 567 bytes
+  116, 0, 0, 1, 0, 21, 58, 61, 55, 1, 8, -7, 5, 64, 31, 47, 1, -32, 64, 14,
+  13, 18, 31, 64, 31, 31, 2, 16, 64, 14, 14, 20, 15, 64, 15, 29, 18, 18, 96, 23,
+  31, 46, 64, 2, 30, 16, 16, 96, 100, 29, 1, 64, 17, 30, 15, 16, 64, 2, 14, 31,
+  1, 64, 0, 28, 16, 17, 64, 17, 15, 15, 16, 64, 2, 12, 31, 2, 64, 0, 31, 16,
+  17, 64, 18, 14, 31, 17, 64, 1, 30, 31, 3, 64, 1, 14, 16, 18, 64, 1, 0, 31,
+  18, 64, 1, 14, 16, 20, 64, 1, 16, 31, 1, 64, -15, 2, 48, 31, 96, -79, -15, 17,
+  64, 17, 1, -16, 30, 64, 33, 1, -17, 31, 64, 49, 17, -64, 16, 64, 17, -15, -17, 16,
+  64, 17, 1, -64, 31, 64, 1, 1, -16, 47, 96, 29, 33, -15, 96, -87, -15, 45, 96, -91,
+  17, 30, 64, -15, 2, -32, 31, 96, -87, 17, 29, 64, -15, -15, -1, 32, 64, -15, 1, -32,
+  31, 64, -15, 1, -16, 16, 64, -32, 17, -16, 15, 64, -15, 17, -16, 0, 64, 1, 33, -48,
+  -32, 64, -31, 17, 0, -32, 64, -31, 48, -15, -112, 64, -31, 1, -1, -16, 96, -114, 30, -46,
+  96, 54, 30, -14, 64, -31, 1, 1, -32, 64, -47, 1, 15, -48, 96, -106, 31, -47, 64, -47,
+  -16, 16, -31, 64, -32, 1, -15, -1, 64, -30, -15, 0, -63, 64, -32, 1, 16, -1, 64, -47,
+  -16, 16, -15, 64, -32, -15, 17, -48, 64, -47, -48, 16, 17, 64, -48, -14, 16, -16, 64, -31,
+  -16, 33, -32, 64, -63, -15, 33, -16, 64, -16, -30, 16, -2, 64, -15, -32, 16, -15, 64, -32,
+  -15, 33, 1, 64, -15, -48, 32, -16, 64, -32, -15, 65, 1, 64, -16, -32, 33, -16, 64, -15,
+  -47, 32, 33, 96, 26, -30, 1, 96, 92, -31, 17, 64, 17, -48, -16, 16, 64, 32, -31, -15,
+  1, 96, -40, 30, 17, 64, 17, -64, -16, 16, 64, 32, -15, -15, 1, 96, -40, 28, 33, 64,
+  33, -15, -15, 16, 64, 16, -32, -15, 17, 64, 16, -32, 1, 49, 64, 16, -32, -15, 33, 96,
+  -106, 17, 33, 64, 16, -32, -15, 65, 64, 31, 0, 3, 17, 64, 16, 32, -15, -15, 96, 83,
+  17, 31, 64, 18, 17, -2, -31, 64, 19, 31, 12, -15, 64, 17, 16, -2, 1, 64, 17, 16,
+  12, 2, 64, 16, 17, 15, -16, 64, 16, 31, -16, -14, 96, 90, 33, 29, 96, 82, -31, 1,
+  64, 31, 17, 14, 1, 64, 16, 47, 13, -14, 64, 31, 0, -1, 1, 64, 31, 16, 14, 1,
+  64, 31, 17, 15, -16, 96, 29, 30, -15, 64, 31, 18, 15, -2, 64, 16, 17, 13, 14, 64,
+  30, 19, 0, 9, 64, 30, 16, 31, 15, 64, 30, 2, -1, 13, 96, 9, 30, 64, 14, 16,
+  47, 14, 64, 30, 16, 16, 13, 64, 29, 16, -16, 13, 64, 15, 31, 16, 14, 64, 29, 16,
+  1, 15, 64, 14, 15, 31, 28, 64, 46, 16, 0, -1, 64, 14, 31, 1, 31, 64, 29, 31,
+  1, -3, 64, 14, 13, 17, 17, 64, 29, 31, 1, 15, 64, 13, 15, 1, 30, 64, 30, 47,
+  18, 15, 64, 28, 14, 18, 15,
+};
+const int8_t wkL[] PROGMEM = {  // 932 -> 480 bytes
+  116, 0, 0, 1, 0, 49, 58, 61, 52, -4, 8, -7, 0, 96, 7, 31, 15, 96, 100, 29,
+  15, 96, 23, 30, 47, 96, 108, 46, -15, 64, 15, 13, 18, 2, 96, 6, -31, 96, -91, -31,
+  17, 96, 100, 29, 1, 96, 6, -31, 96, 108, 30, 17, 96, 101, -63, 17, 96, 6, -15, 96,
+  100, 28, 2, 96, 101, -15, 17, 96, 102, -31, 17, 96, 108, 30, 49, 96, 101, -31, 33, 96,
+  96, 33, 64, 0, 30, 16, 20, 96, 96, 17, 96, 102, 47, -13, 96, 40, 17, 64, 17, 1,
+  -16, 14, 96, 102, 18, -2, 96, 38, 19, 12, 96, 39, 17, -31, 96, 102, 17, -4, 64, 0,
+  17, -16, 31, 96, 5, 33, 32, 32, 10, 96, 36, -31, 96, 102, 47, -2, 32, 32, 3, 64,
+  -16, 17, -16, 16, 64, -14, 1, -32, 15, 96, -90, 31, 31, 64, -32, 17, -16, 15, 96, 54,
+  31, -15, 96, 36, -47, 96, -114, 30, -31, 96, -93, -31, -1, 96, -90, 30, -1, 96, 6, 30,
+  96, 38, 30, 15, 96, 6, 30, 96, -122, 29, 15, 96, 15, -15, -15, 96, -30, 29, -15, 64,
+  -32, -15, -16, 15, 64, -31, 1, 1, 1, 96, 102, 30, -15, 64, -48, -16, 16, -15, 64, -31,
+  -15, 16, 0, 96, 98, 29, 1, 96, 38, 45, 1, 96, 42, -2, 2, 64, -64, -15, 32, -16,
+  64, -16, -14, 16, 14, 64, -15, 0, 17, 1, 96, 102, 30, 18, 96, 42, -1, 2, 64, -32,
+  -15, 64, 1, 96, 42, -1, 2, 64, -16, -15, 32, -15, 96, 19, 33, 1, 96, 68, 17, 96,
+  42, -15, 15, 64, 32, -15, -15, 1, 96, 72, 31, 96, 42, -15, 15, 64, 33, 1, -16, 1,
+  96, 72, 31, 64, 32, -31, -16, 32, 96, 98, -15, 1, 96, 74, -15, 1, 96, -30, -15, 33,
+  96, 23, 17, 17, 96, 98, -15, 1, 64, 31, -16, 2, 17, 96, 98, -15, 1, 96, 66, 17,
+  64, 17, 1, -2, 1, 96, 70, -15, 1, 64, 16, 32, -16, -15, 96, 83, 18, 47, 96, 23,
+  31, -15, 96, 102, -15, 47, 96, 66, 17, 96, 83, 17, 30, 64, 31, 17, 15, 1, 96, 71,
+  31, 47, 96, 98, -15, 1, 96, 90, 17, 31, 96, 7, 31, 1, 96, 20, -15, 96, 78, 33,
+  -31, 96, 71, 31, -31, 96, 70, 49, 9, 64, 31, 16, 31, 15, 64, 31, 2, -16, 13, -128,
+  96, 104, 33, 14, 96, 99, 31, -47, 64, 31, 0, -1, 13, 96, 100, 31, 14, 96, 67, 31,
+  15, 96, 100, 31, 12, 96, 75, 47, -15, 96, 69, -1, 15, 96, 70, -15, 13, 64, 15, 29,
+  16, 1, 64, 31, 15, 15, 15, 96, 68, -17, 64, 16, 31, 16, 15, 64, 31, 14, 16, 15,
+};
+const int8_t balance[] PROGMEM = {  // 20 -> 15 bytes
+  1, 0, 0, 1, 32, 0, -1, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t buttUp[] PROGMEM = {  // 20 -> 21 bytes
+  1, 0, 15, 1, 0, 20, 40, 0, 0, 5, 5, 3, 3, 90, 90, 45, 45, -60, -60, 5,
+  5,
+};
+const int8_t calib[] PROGMEM = {  // 20 -> 5 bytes
+  1, 0, 0, 1, -128,
+};
+const int8_t dropped[] PROGMEM = {  // 20 -> 20 bytes
+  1, 0, -75, 1, 32, -14, -1, 30, -5, -5, 15, 15, -75, -75, 45, 45, 60, 60, -30, -30,
+};
+const int8_t lifted[] PROGMEM = {  // 20 -> 16 bytes
+  1, 0, 75, 1, 32, 2, -1, -20, 50, 50, 70, 70, 45, 45, 75, 75,
+};
+const int8_t lnd[] PROGMEM = {  // 20 -> 17 bytes
+  1, 0, 0, 1, 32, 3, -1, 50, -20, 60, 60, 80, 80, -20, -20, -30, -30,
+};
+const int8_t rest[] PROGMEM = {  // 20 -> 21 bytes
+  1, 0, 0, 1, 0, -30, -80, -45, 0, -3, -3, 3, 3, 75, 75, 75, 75, -55, -55, -55,
+  -55,
+};
+const int8_t sit[] PROGMEM = {  // 20 -> 20 bytes
+  1, 0, -30, 1, 32, -12, -1, -45, -5, -5, 20, 20, 45, 45, 105, 105, 45, 45, -45, -45,
+};
+const int8_t str[] PROGMEM = {  // 20 -> 16 bytes
+  1, 0, 20, 1, 32, 50, 63, 30, -5, -5, -75, -75, 30, 30, 60, 60,
+};
+const int8_t up[] PROGMEM = {  // 20 -> 15 bytes
+  1, 0, 0, 1, 32, 0, -1, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t zero[] PROGMEM = {  // 20 -> 5 bytes
+  1, 0, 0, 1, -128,
+};
+const int8_t ang[] PROGMEM = {  // 147 -> 114 bytes
+  -7, 0, 0, 1, 3, 4, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 32,
+  32, -11, -1, 1, -50, 45, -5, -5, 20, 20, -19, 47, 71, 90, -16, -55, 41, 47, 16, 32,
+  0, -65, 1, -70, 60, 85, 19, 76, -68, -31, 32, 32, 1, -1, 1, -20, -109, 65, 97, 14,
+  68, -77, 27, -11, 48, 32, 1, 49, 3, -84, -76, 90, -60, 64, 4, 32, -13, -1, 3, 38,
+  -80, -3, -3, 3, 3, 70, 78, 70, 22, -55, -8, -35, -3, 16, 6, 32, -11, -1, 2, 0,
+  0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 0,
+};
+const int8_t bf[] PROGMEM = {  // 127 -> 89 bytes
+  -6, 0, 0, 2, 0, 0, 0, 32, 1, -1, 3, -35, 27, 27, 27, 27, -9, -9, -9, -9,
+  8, 2, 32, 0, -1, 3, 5, 5, -23, -23, 50, 50, 22, 22, 32, 0, 32, 0, -1, 13,
+  -6, -6, 30, 30, -18, -18, 67, 67, 0, -1, 110, 32, 0, -49, 13, 30, 30, 57, 57, -30,
+  -30, 48, 0, 0, 32, 1, 51, 2, 18, 33, 33, -22, -22, 6, 32, 1, -1, 3, 0, 15,
+  15, 15, 15, 15, 15, 15, 15, 8, 2,
+};
+const int8_t bx[] PROGMEM = {  // 247 -> 160 bytes
+  -12, 0, 0, 1, 6, 7, 5, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, -57, -4, 1, 39, -22, 22, 44, 44, 74, 74, 74, 74, -14, -14, 12, 32, 1, -100, 0,
+  26, 31, 3, 91, 32, 32, 1, -9, 2, 9, 35, 35, 3, 85, 85, 43, 43, 10, 32, 0,
+  -52, 3, 44, 44, 18, 18, 8, 4, 32, 1, 51, 1, 0, 53, 44, -47, -53, 12, 32, 1,
+  -33, 3, 13, -34, 62, 45, 47, 71, 22, 22, 64, 1, 32, 5, 63, 0, -13, -22, 62, -34,
+  47, 45, -53, 71, 32, -57, -1, 3, 17, 0, 0, 0, 0, 65, 65, 30, 30, 65, 65, 26,
+  26, 16, 4, 32, 0, -1, 2, 23, 23, -12, -12, 3, 3, 30, 30, 0, 32, 1, -4, 0,
+  0, 50, 50, 59, 59, -32, -32, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 12,
+};
+const int8_t chr[] PROGMEM = {  // 107 -> 72 bytes
+  -5, 0, 0, 1, 2, 3, 2, 32, 6, -1, 3, -20, -60, 30, 30, 110, 125, 60, 60, -40,
+  -50, 4, 1, 32, 0, 68, 1, 88, -43, 8, 32, 7, -93, 3, 40, 0, -35, 34, -60, -10,
+  -45, 16, 0, 32, 7, -9, 0, 65, -5, -60, 36, 10, 87, 70, -60, -42, -41, 32, 7, -2,
+  1, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 12,
+};
+const int8_t ck[] PROGMEM = {  // 67 -> 49 bytes
+  -3, 0, 0, 1, 0, 1, 2, 32, 1, -65, 3, 45, 45, 35, 38, 50, -30, -10, -20, 6,
+  1, 32, 1, -1, 0, -45, 35, 45, 50, 38, -10, -30, -20, 0, 32, 1, -1, 3, 0, 30,
+  30, 30, 30, 30, 30, 30, 30, 8, 0,
+};
+const int8_t clap[] PROGMEM = {  // 247 -> 177 bytes
+  -12, 0, 0, 1, 5, 8, 2, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, -10, -1, 1, -5, -120, 5, 5, 3, 3, 71, 71, -58, -58, -60, -60, 74, 74, 12, 32,
+  2, -1, 0, -4, 47, 47, -25, -25, 9, 9, 90, 90, 32, 6, 63, 3, 110, 120, 12, 12,
+  -16, -16, -37, -37, 48, 5, 32, 6, 51, 2, 30, -120, -41, -41, 16, 16, 2, 32, 7, 51,
+  3, 25, 110, 120, 12, -85, -37, 60, 64, 4, 32, 7, 63, 3, 0, 30, -120, -41, -41, -15,
+  -15, 16, 16, 48, 2, 32, 7, 63, 3, -25, 110, 120, -85, 12, -16, -16, 60, -37, 64, 4,
+  32, 7, 63, 3, 0, 30, -120, -41, -41, -15, -15, 16, 16, 48, 2, 32, 2, -1, 3, 120,
+  71, 71, -45, -45, -56, -56, 50, 50, 8, 0, 32, 0, -52, 1, 72, 72, -51, -51, 12, 32,
+  -10, -1, 0, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t cmh[] PROGMEM = {  // 447 -> 213 bytes
+  -22, 0, -15, 1, 2, 19, 3, 32, 1, -1, 2, -69, 27, 26, 31, 25, 28, 22, 28, 25,
+  4, 32, 1, 0, 3, 82, 16, 10, 32, 1, 0, 3, 45, 48, 0, 96, 0, -1, 0, -2,
+  -27, 35, 35, 96, 0, -1, 0, -21, 101, -44, -103, 32, 0, -65, 0, 16, 11, 46, 39, 41,
+  35, 13, 32, 0, -1, 0, 10, 10, 44, 45, 40, 40, 20, 23, 96, 0, -1, 0, 97, -7,
+  27, 24, 32, 0, -1, 0, 23, 20, 26, 39, 21, 35, 24, 26, 96, 0, -1, 0, 82, -51,
+  -61, 83, 96, 0, -1, 0, 33, -77, -34, -51, 96, 0, -37, 0, 79, 60, 47, 96, 0, -1,
+  0, 94, -17, 50, 63, 96, 0, -1, 0, 86, -69, -103, 81, 32, 0, -33, 0, 39, 46, 10,
+  14, 13, 38, 42, 32, 0, -1, 0, 45, 44, 11, 10, 23, 20, 41, 39, 96, 0, -1, 0,
+  -97, 54, -127, -114, 32, 0, -1, 0, 39, 26, 22, 25, 26, 24, 34, 20, 96, 0, -9, 0,
+  -36, 84, -61, 5, 96, 0, -1, 0, 59, 18, -36, -51, 32, 1, -2, 3, 92, 30, 62, 62,
+  65, 65, -2, -2, 16, 20, 32, 1, 0, 3, 59, 8, 0,
+};
+const int8_t dg[] PROGMEM = {  // 227 -> 130 bytes
+  -11, 0, 0, 1, 1, 9, 5, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 1, -1, 1, 4, 56, 56, 41, 41, -32, -32, 4, 4, 32, 32, 1, 51, 1, 7, 35,
+  70, -39, -25, 48, 32, 1, 51, 1, 6, 16, 73, -19, -29, 64, 32, 1, 51, 1, 10, 35,
+  70, -29, -25, 48, 32, 1, 51, 1, 7, 56, 56, -32, -32, 32, 32, 1, 51, 1, 2, 70,
+  35, -25, -41, 48, 32, 1, 51, 1, -2, 73, 16, -29, -19, 64, 32, 1, 51, 1, -5, 70,
+  35, -25, -29, 48, 32, 1, 51, 3, -7, 56, 56, -32, -32, 32, 1, 32, 1, -1, 3, 0,
+  30, 30, 30, 30, 30, 30, 30, 30, 8, 0,
+};
+const int8_t dropRec[] PROGMEM = {  // 87 -> 58 bytes
+  -4, 0, 0, 1, 0, 0, 0, 32, -13, -1, 1, 20, 40, 5, 5, 3, 3, 19, 19, 45,
+  45, -22, -22, 5, 5, 64, 32, 0, 17, 1, 53, -40, 16, 32, 0, 50, 0, 43, -28, -31,
+  32, -13, -1, 0, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t ff[] PROGMEM = {  // 127 -> 102 bytes
+  -6, 0, 0, 1, 0, 0, 0, 32, 1, -1, 1, -106, 22, 22, 30, 30, 86, 86, 30, 30,
+  16, 32, 1, -1, 1, -120, 45, 45, 5, 5, 96, 96, 66, 66, 32, 32, 1, -1, 13, -100,
+  -56, -56, 79, 79, 40, 40, -56, -56, 64, 1, 90, 32, 1, -1, 13, -50, 40, 40, -23, -23,
+  9, 9, 65, 65, 48, 0, 0, 0, 0, -80, -45, 0, -3, -3, 3, 3, 58, 58, 58, 58,
+  -39, -39, -39, -39, 32, 2, 0, 0, 32, 0, -1, 3, 30, 30, 30, 30, 30, 30, 30, 30,
+  16, 0,
+};
+const int8_t fiv[] PROGMEM = {  // 187 -> 132 bytes
+  -9, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 1, -1, 1, 18, 10, 24, 42, 28, 75, 46, 15, 38, 12, 32, 1, -65, 1, 26, 21,
+  33, 28, 12, 49, 17, 54, 16, 32, 0, -56, 1, 7, 22, 39, 8, 32, -57, -1, 3, 32,
+  -21, 21, 42, 42, 30, 21, 62, 25, 72, 69, -23, 16, 16, 4, 32, 1, 17, 2, 15, -125,
+  28, 2, 32, 1, -77, 3, 23, -109, 24, 59, 64, 19, 12, 20, 0, 0, 0, -45, 0, -5,
+  -5, 20, 20, 45, 38, 105, 105, 45, 45, -45, -45, 8, 0, 0, 0, 32, -12, -1, 0, 0,
+  0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t flip[] PROGMEM = {  // 127 -> 98 bytes
+  -6, 0, 0, 2, 0, 4, 0, 32, -15, -1, 3, -15, 15, -8, -8, 15, 32, 1, -2, 35,
+  -25, 47, 45, -23, 32, 2, 0, 15, -40, 22, 0, -2, -2, 1, 1, 3, -48, 51, 1, 42,
+  46, 40, 42, 16, 1, 0, 0, 32, 0, 109, 3, -84, 55, 90, -28, 60, 48, 0, 32, 0,
+  38, 0, -76, 60, 19, 32, 0, -1, 1, 35, 35, 35, 35, -28, -28, -28, -28, 16, 32, -9,
+  -1, 1, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 8,
+};
+const int8_t flipD[] PROGMEM = {  // 107 -> 79 bytes
+  -5, 0, 0, 1, 0, 0, 0, 32, 0, -1, 3, 54, 54, 54, 54, -18, -18, -18, -18, 8,
+  2, 32, 1, -1, 3, 80, 10, 10, -44, -44, 100, 100, 50, 50, 48, 0, 32, 0, -1, 3,
+  -16, -16, 52, 52, -56, -56, 125, 125, 0, 1, 32, 0, -1, 3, 54, 54, 82, 82, -44, -44,
+  -50, -50, 48, 4, 32, 1, -1, 3, 0, 30, 30, 30, 30, 30, 30, 30, 30, 8, 2,
+};
+const int8_t flipF[] PROGMEM = {  // 127 -> 88 bytes
+  -6, 0, 0, 1, 0, 0, 0, 32, 1, -1, 1, -80, 22, 22, 30, 30, 86, 86, 30, 30,
+  8, 32, 0, 51, 0, 48, 48, 102, 102, 32, 0, -1, 1, -20, -20, 40, 40, 42, 42, -12,
+  -12, 48, 32, 0, -1, 0, 12, 12, -22, -22, -3, -3, 31, 31, 32, -9, -1, 1, 10, -80,
+  -45, -3, -3, 3, 3, 70, 70, 70, 70, -55, -55, -55, -55, 32, 32, 1, -1, 1, 0, 30,
+  30, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t gdb[] PROGMEM = {  // 87 -> 63 bytes
+  -4, 0, -30, 1, 0, 2, 3, 32, -11, -1, 1, 19, -45, -5, -5, 20, 20, 66, 66, 95,
+  78, 12, 12, -45, -38, 48, 32, 1, -1, 1, -13, 37, 37, 110, 91, 84, 84, -50, -40, 64,
+  32, 5, 17, 0, 24, 45, 22, 62, 32, 5, -1, 1, 0, -45, 45, 45, 105, 105, 45, 45,
+  -45, -45, 32,
+};
+const int8_t hds[] PROGMEM = {  // 167 -> 104 bytes
+  -8, 0, 0, 1, 4, 5, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 1, 3, 0, 82, 112, 112, 32, 0, -1, 1, 50, 50, 0, 0, 0, 0, 0, 0, 12,
+  32, 0, 12, 1, 81, 81, 16, 32, 0, -60, 1, 112, 62, 13, 32, 32, 1, -52, 0, 89,
+  90, 115, 13, 74, 32, -9, -1, 1, 57, -80, -45, -3, -3, 3, 3, 70, 70, -3, -3, -73,
+  -73, 37, 37, 12, 32, -9, -1, 1, 0, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30,
+  30, 30, 30, 8,
+};
+const int8_t hg[] PROGMEM = {  // 207 -> 134 bytes
+  -10, 0, 0, 1, 5, 6, 2, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, -57, -4, 1, 39, -22, 22, 44, 44, 74, 74, 74, 74, -14, -14, 12, 32, 0, -100, 0,
+  31, 3, 91, 32, 32, 0, -9, 2, 35, 35, 3, 85, 85, 43, 43, 10, 32, 1, -1, 1,
+  73, 28, 28, 40, 40, 65, 53, 22, 22, 8, 32, 1, 51, 2, 11, -93, -99, 68, 71, 4,
+  32, 1, 51, 1, -31, -97, -92, 81, 56, 4, 32, -57, -1, 1, 0, 0, 0, 0, 0, 65,
+  65, 30, 30, 65, 65, 26, 26, 16, 32, 0, -1, 2, 23, 23, 50, 50, 59, 59, -32, -32,
+  0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 12,
+};
+const int8_t hi[] PROGMEM = {  // 107 -> 82 bytes
+  -5, 0, 0, 1, 1, 2, 3, 32, 6, -1, 3, -20, -60, 35, 30, 120, 105, 75, 60, -40,
+  -30, 4, 2, 32, 3, 125, 3, 35, -5, -99, 125, 95, 40, 75, -45, 10, 0, 32, 7, 17,
+  0, 40, 0, -35, -90, 62, 32, -11, -65, 1, 0, -45, -5, -5, 20, 20, 45, 45, 105, 105,
+  45, 45, -45, 8, 32, -12, -1, 1, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30,
+  30, 5,
+};
+const int8_t hsk[] PROGMEM = {  // 147 -> 110 bytes
+  -7, 0, 0, 1, 2, 3, 3, 32, 7, -1, 3, 36, -20, -60, 31, 30, 120, 50, 96, 60,
+  -40, -12, 12, 2, 32, 7, -11, 3, 40, 0, -35, -60, 125, 47, 75, -45, -10, 16, 10, 32,
+  7, -111, 3, 35, -5, -60, -47, 59, -9, 8, 1, 32, 7, -111, 0, 43, 0, -35, -60, 47,
+  -5, 32, 7, -111, 2, 35, -5, -60, -47, 59, -12, 20, 32, -9, -65, 3, 14, 0, -45, -5,
+  -5, 20, 20, 45, 45, 105, 105, 45, 45, -45, 12, 0, 32, -11, -1, 0, 0, 0, 0, 0,
+  0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t hu[] PROGMEM = {  // 227 -> 149 bytes
+  -11, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, -57, -4, 1, 39, -22, 22, 44, 44, 74, 74, 74, 74, -14, -14, 12, 32, 1, -100, 0,
+  26, 31, 3, 91, 32, 32, 1, -9, 2, 9, 35, 35, 3, 85, 85, 43, 43, 10, 32, 0,
+  -52, 1, 40, 40, 21, 21, 8, 32, 5, 51, 3, 17, -22, -106, 65, 53, -47, 12, 6, 32,
+  1, -1, 3, 33, 9, 0, 42, 42, -40, -31, 24, 24, 32, 0, 32, 1, 51, 3, 8, -93,
+  -99, 37, 40, 16, 20, 32, -57, -1, 3, 17, 0, 0, 0, 0, 23, 23, -12, -12, 3, 3,
+  30, 30, 12, 0, 32, 1, -4, 1, 0, 50, 50, 59, 59, -32, -32, 16, 32, 0, -1, 1,
+  30, 30, 30, 30, 30, 30, 30, 30, 12,
+};
+const int8_t hunt[] PROGMEM = {  // 147 -> 109 bytes
+  -7, 0, 0, 1, 0, 0, 0, 32, 6, -1, 1, -10, 10, 16, 16, 30, 30, 30, 30, 30,
+  30, 48, 32, -2, -1, 1, -5, -120, -10, 10, 10, -20, -20, 4, 4, 22, 22, 78, 78, 59,
+  59, 16, 32, 6, -1, 1, 0, -30, 40, 40, 41, 41, 20, 20, 40, 40, 64, 32, 2, -1,
+  0, 40, 70, 70, 61, 61, 10, 10, 20, 20, 32, 4, 0, 1, 0, 0, 32, 2, -1, 1,
+  70, 16, 16, 40, 40, -13, -13, -9, -9, 4, 32, -6, -1, 1, 0, 0, 0, 0, 0, 0,
+  20, 20, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t jmp[] PROGMEM = {  // 87 -> 67 bytes
+  -4, 0, 0, 1, 1, 2, 2, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 0, -1, 3, 60, 60, 45, 45, -29, -29, -29, -29, 48, 4, 32, 0, -1, 3, 37, 37,
+  38, 38, 26, 26, 63, 63, 0, 0, 32, -10, -1, 1, -80, -45, -3, -3, 3, 3, 60, 60,
+  60, 60, -28, -28, -28, -28, 48,
+};
+const int8_t kc[] PROGMEM = {  // 187 -> 119 bytes
+  -9, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 16,
+  32, -9, -1, 1, 52, 12, -12, 12, 12, -24, -24, 42, 42, 15, 15, 6, 6, 54, 54, 48,
+  32, 0, -120, 1, 6, -2, 64, 32, 1, -1, 3, 45, 46, 51, 22, -30, -3, -12, 41, 87,
+  48, 1, 32, 0, 17, 2, 74, -65, 4, 32, 1, 127, 3, 36, 30, 42, 15, -25, -33, 6,
+  54, 0, 0, 32, 1, 17, 2, 9, -71, 40, 1, 32, 1, 17, 3, 0, -34, 60, 48, 0,
+  32, -10, -1, 1, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30, 16,
+};
+const int8_t knock[] PROGMEM = {  // 87 -> 55 bytes
+  -4, 0, 0, 1, 1, 2, 2, 32, -10, -1, 1, 9, -9, 9, 9, -18, -18, 30, 30, 13,
+  13, -21, -21, 37, 37, 64, 32, 1, 0, 1, 25, 48, 32, 1, 0, 0, -25, 32, -9, -4,
+  1, 0, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t launch[] PROGMEM = {  // 107 -> 91 bytes
+  -5, 0, 0, 2, 0, 0, 0, 32, 2, -1, 1, 23, 16, 16, 15, 15, -8, -8, 15, 15,
+  8, 0, 0, 90, 0, 0, -3, -3, 10, 10, 21, 21, 60, 60, 35, 35, -34, -34, 64, 4,
+  1, -50, 32, 6, -1, 15, 0, 25, -3, -3, 32, 32, 12, 12, 15, 15, 75, 1, 0, 0,
+  32, -10, -1, 3, 10, 0, 0, 0, 0, 0, -5, -5, 25, 25, 15, 15, -9, -9, 8, 0,
+  32, 2, -49, 0, -1, 6, 6, 17, 17, 13, 13,
+};
+const int8_t lpov[] PROGMEM = {  // 747 -> 420 bytes
+  -37, 0, 0, 1, 4, 35, 2, 32, 0, 63, 1, 30, 30, 74, 74, 30, 30, 8, 32, 0,
+  -1, 0, 54, 51, 68, 85, -9, -5, -29, -5, 32, 0, 68, 0, 49, -7, 32, 0, 34, 0,
+  68, -22, 32, 0, 66, 1, 13, -8, 48, 32, 0, -65, 0, 58, -5, 53, 80, -8, 13, -16,
+  32, 0, -65, 0, 63, -26, 58, 67, -6, 39, -21, 32, 0, -1, 0, 66, -34, 62, 51, -3,
+  57, -6, -22, 32, 0, -1, 0, 69, -28, 66, 33, 0, 52, -4, -16, 32, 0, -1, 0, 71,
+  -19, 69, 14, 4, 40, -1, -4, 32, 0, -1, 0, 73, -11, 71, -5, 9, 30, 3, 14, 32,
+  0, -1, 0, 74, -3, 73, -9, 15, 21, 8, 26, 32, 0, -1, 0, 72, 5, 74, -4, 24,
+  13, 14, 24, 96, 0, -5, 0, 99, 55, 107, 8, 32, 0, -1, 0, 83, 18, 72, 10, 14,
+  3, 28, 10, 32, 0, -1, 0, 84, 25, 70, 17, -4, -2, 38, 5, 32, 0, -1, 0, 78,
+  31, 66, 23, -16, -5, 52, 1, 32, 0, -1, 0, 66, 37, 68, 29, -22, -7, 57, -3, 32,
+  0, -1, 0, 49, 43, 79, 36, -21, -9, 39, -6, 32, 0, -33, 0, 32, 49, 86, 42, -17,
+  13, -8, 32, 0, -33, 0, 13, 54, 85, 48, -5, -5, -9, 32, 0, 127, 0, -5, 58, 80,
+  53, 13, -8, -16, 32, 0, -1, 0, -26, 63, 67, 58, 39, -6, -21, -8, 32, 0, -1, 0,
+  -34, 66, 51, 62, 57, -3, -22, -6, 32, 0, -1, 0, -28, 69, 33, 66, 52, 0, -16, -4,
+  32, 0, -1, 0, -19, 71, 14, 69, 40, 4, -4, -1, 32, 0, -1, 0, -11, 73, -5, 71,
+  30, 9, 14, 3, 32, 0, -1, 0, -3, 74, -9, 73, 21, 15, 26, 8, 32, 0, -1, 0,
+  5, 72, -4, 74, 13, 24, 24, 14, 96, 0, -9, 0, 54, -73, -125, 6, 32, 0, -1, 0,
+  18, 83, 10, 72, 3, 14, 10, 28, 32, 0, -1, 0, 25, 84, 17, 70, -2, -4, 5, 38,
+  32, 0, -1, 0, 31, 78, 23, 66, -5, -16, 1, 52, 32, 0, -1, 0, 37, 66, 29, 68,
+  -7, -22, -3, 57, 32, 0, -1, 0, 43, 49, 36, 79, -9, -21, -6, 39, 32, 0, -17, 0,
+  49, 32, 42, 86, -17, -8, 13, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t lucky[] PROGMEM = {  // 207 -> 134 bytes
+  -10, 0, 0, 1, 5, 6, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, -57, -4, 1, 39, -22, 22, 44, 44, 74, 74, 74, 74, -14, -14, 12, 32, 0, -100, 0,
+  31, 3, 91, 32, 32, 0, -9, 2, 35, 35, 3, 85, 85, 43, 43, 10, 32, 1, -1, 1,
+  73, 28, 28, 51, 51, 65, 53, 22, 22, 8, 32, 1, -33, 3, 1, 65, -62, 124, 124, 40,
+  -25, -25, 12, 0, 32, 0, 3, 0, 62, 53, 32, -57, -2, 3, 0, 0, 0, 0, 0, 65,
+  30, 30, 65, 65, 26, 26, 16, 4, 32, 0, -1, 2, 23, 23, 50, 50, 59, 59, -32, -32,
+  0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 12,
+};
+const int8_t mw[] PROGMEM = {  // 247 -> 168 bytes
+  -12, 0, 0, 1, 3, 10, 5, 32, 0, -1, 1, 51, 51, 51, 51, -12, -12, -12, -12, 8,
+  32, 0, -1, 1, 20, 20, 20, 20, 50, 50, 50, 50, 64, 32, 0, -1, 3, 49, 23, 61,
+  33, 10, 9, 6, 9, 16, 12, 32, 0, 0, 3, 32, 4, 32, 0, -1, 3, 38, 18, 50,
+  24, 30, 27, 24, 27, 0, 1, 32, 0, -1, 2, 50, 29, 60, 42, 3, 34, -12, 24, 0,
+  32, 0, -1, 0, 23, 49, 33, 57, 12, 10, 9, 12, 32, -10, -1, 3, 6, 6, 6, 6,
+  -12, -12, 21, 52, 29, 52, 3, -8, 6, 7, 32, 4, 32, -10, -1, 3, 0, 0, 0, 0,
+  0, 0, 17, 40, 27, 54, 30, 25, 21, 17, 0, 1, 32, 0, -1, 2, 31, 50, 42, 60,
+  34, 0, 24, -15, 0, 32, 0, -65, 0, 38, 15, 50, 21, 30, 27, 27, 32, 0, -17, 1,
+  30, 30, 30, 30, 30, 30, 30, 32,
+};
+const int8_t nd[] PROGMEM = {  // 87 -> 73 bytes
+  -4, 0, 0, 1, 1, 2, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 16,
+  32, -9, -4, 3, 4, 12, -12, 12, 12, -24, -24, 6, 6, 6, 6, 54, 54, 32, 1, 32,
+  -57, -4, 2, -4, -7, 7, 14, 14, 47, 47, 44, 44, 16, 16, 0, 32, -9, -4, 1, 0,
+  0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 16,
+};
+const int8_t pd[] PROGMEM = {  // 167 -> 98 bytes
+  -8, 0, 0, 1, 4, 5, 2, 32, -12, -1, 1, -45, -5, -5, 20, 20, 45, 45, 105, 105,
+  45, 45, -45, -45, 8, 32, 4, -85, 0, 0, 30, -80, 15, 80, 80, 32, -15, -2, 1, 45,
+  0, 0, 0, 0, 6, 6, 6, -60, 79, 79, 56, 16, 32, 0, 103, 3, 45, -75, 90, 0,
+  -60, 8, 20, 32, 0, -120, 3, 25, 45, 30, 0, 32, 0, -128, 0, 30, 32, 0, -128, 3,
+  45, 16, 20, 32, 1, -1, 3, 0, 30, 30, 30, 30, 30, 30, 30, 30, 8, 0,
+};
+const int8_t pee[] PROGMEM = {  // 107 -> 81 bytes
+  -5, 0, 0, 1, 2, 3, 3, 32, -13, -1, 1, 30, 20, 15, -10, 60, -10, 40, 40, 90,
+  45, 10, 60, 70, 45, 6, 32, 1, -1, 3, 45, 60, 53, 115, 60, -30, 40, 50, 21, 2,
+  10, 32, 1, -1, 3, 30, 40, 40, 90, 45, 10, 50, 70, 45, 32, 0, 32, 0, 68, 0,
+  103, 80, 32, -13, -1, 1, 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+  8,
+};
+const int8_t pick[] PROGMEM = {  // 127 -> 92 bytes
+  -6, 0, 0, 1, 0, 0, 0, 32, 2, -1, 1, -10, 16, 16, 30, 30, 30, 30, 30, 30,
+  32, 32, 4, 0, 3, 65, 48, 2, 0, 20, 10, 65, -10, 17, 7, -23, -13, 12, 2, 7,
+  17, 6, 27, 57, 36, 8, 0, 0, 0, 32, -14, -1, 1, 90, 18, 6, -24, -12, 61, 49,
+  36, 48, -44, -20, 43, 19, 4, 32, 4, 0, 1, 0, 8, 32, -5, -1, 0, 0, 0, 0,
+  0, 0, 0, 0, 20, 20, 30, 30, 30, 30, 30, 30,
+};
+const int8_t pickD[] PROGMEM = {  // 107 -> 61 bytes
+  -5, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 6, 0, 3, -15, 65, 16, 2, 32, 0, -1, 3, 54, 54, 54, 54, -18, -18, -18, -18,
+  8, 0, 32, 6, 0, 0, 5, 0, 32, 2, -1, 0, 0, 25, 25, 30, 30, 45, 45, 40,
+  40,
+};
+const int8_t pickF[] PROGMEM = {  // 127 -> 84 bytes
+  -6, 0, 0, 1, 0, 0, 0, 32, 2, -1, 1, -10, 16, 16, 30, 30, 30, 30, 30, 30,
+  32, 32, 4, 0, 1, 65, 48, 32, -6, -1, 1, 10, -10, 10, 10, -20, -20, 5, 5, 10,
+  10, 20, 20, 50, 50, 12, 32, 2, -1, 1, 75, 53, 53, 40, 40, -28, -28, 35, 35, 4,
+  32, 4, 0, 1, 0, 8, 32, -6, -1, 0, 0, 0, 0, 0, 0, 0, 20, 20, 30, 30,
+  30, 30, 30, 30,
+};
+const int8_t pu[] PROGMEM = {  // 207 -> 122 bytes
+  -10, 0, 0, 1, 7, 8, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 1, -2, 0, 15, 35, 40, 21, 50, 15, 15, 41, 32, 0, -120, 1, 30, 14, 16, 32,
+  1, -55, 0, 30, 27, 60, 20, 45, 32, 1, -79, 1, 15, 42, 25, 20, 60, 8, 32, 1,
+  55, 1, 0, 48, 45, 75, 20, 37, 12, 32, 1, 127, 1, -15, 60, 60, 70, 70, 15, 15,
+  60, 16, 32, 1, 63, 3, 0, 30, 30, 110, 110, 60, 60, 12, 1, 32, 1, 63, 3, 30,
+  70, 70, 85, 85, -50, -50, 16, 0, 32, 1, -1, 1, 0, 30, 30, 30, 30, 30, 30, 30,
+  30, 8,
+};
+const int8_t pu1[] PROGMEM = {  // 267 -> 154 bytes
+  -13, 0, 0, 1, 8, 9, 3, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 1, -2, 1, 15, 35, 40, 24, 50, 15, 15, 41, 12, 32, 0, -116, 0, 41, 30, 16,
+  32, 1, -55, 0, 30, 27, 60, 20, 45, 32, 1, -11, 0, 15, 45, 33, 25, 20, 28, 60,
+  32, 1, -17, 3, -45, 41, 48, 75, 100, 80, -20, 89, 4, 4, 32, 0, 34, 3, 80, -15,
+  16, 0, 32, 1, 115, 0, 58, 56, -73, 6, -5, -18, 32, 0, -9, 3, 74, -125, 42, -34,
+  60, -24, 62, 12, 2, 32, 1, -1, 1, 8, 58, -67, 55, 110, 10, 11, -17, 80, 4, 32,
+  0, 34, 3, 85, -6, 16, 0, 32, 1, -65, 1, -21, 49, 34, 93, 83, 21, 51, 89, 12,
+  32, 1, -1, 1, 0, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t put[] PROGMEM = {  // 147 -> 76 bytes
+  -7, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 6, 0, 1, 120, -120, 32, 32, 97, -10, 1, 70, 9, 9, 39, 39, 31, 13, 13, 31,
+  8, 32, 6, 0, 1, 100, -20, 16, 32, 4, 0, 1, -60, 32, 32, 103, -10, 1, 0, 120,
+  0, 0, 0, 30, 30, 30, 30, 30, 30, 12, 32, 2, 0, 1, 0, 16,
+};
+const int8_t putD[] PROGMEM = {  // 107 -> 69 bytes
+  -5, 0, 0, 1, 0, 0, 0, 32, -6, -1, 1, 26, -15, 15, 15, -30, -30, 30, 30, 25,
+  25, 3, 3, 37, 37, 8, 32, 12, 0, 0, 75, 0, 32, -14, -1, 2, -10, 0, 0, 0,
+  0, 13, 13, 24, 24, 40, 40, 35, 31, 2, 32, 4, 0, 2, 0, 0, 32, 2, -1, 0,
+  0, 20, 20, 30, 30, 30, 30, 30, 30,
+};
+const int8_t putF[] PROGMEM = {  // 207 -> 115 bytes
+  -10, 0, 0, 1, 0, 0, 0, 32, 0, -1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 8,
+  32, 2, -1, 1, -10, 23, 23, 23, 23, 35, 35, 35, 35, 12, 32, 3, 0, 0, 38, 5,
+  32, 3, -1, 1, 44, 120, 0, 0, 0, 0, 49, 49, 49, 49, 8, 32, 1, -1, 1, 0,
+  35, 35, 35, 35, 32, 32, 32, 32, 4, 32, 4, 0, 1, 70, 12, 32, 4, 15, 0, 0,
+  20, 20, 20, 20, 32, 1, 15, 1, 56, 5, 5, 5, 5, 4, 32, 3, 0, 1, 25, 1,
+  8, 32, 3, -1, 0, 0, 0, 30, 30, 30, 30, 30, 30, 30, 30,
+};
+const int8_t rc[] PROGMEM = {  // 107 -> 74 bytes
+  -5, 0, 0, 2, 0, 0, 0, 32, 0, -1, 1, -88, -43, 67, 100, 42, -35, 42, 42, 32,
+  32, 0, -81, 0, -83, -88, 100, 60, 42, 50, 32, 55, -1, 3, -8, -20, -11, -1, -1, 18,
+  18, 22, 22, -14, -14, -13, -13, 16, 10, 96, 0, -52, 1, -52, -1, 8, 32, 55, -1, 2,
+  0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+};
+const int8_t rl[] PROGMEM = {  // 127 -> 98 bytes
+  -6, 0, 0, 2, 0, 4, 0, 32, -15, -1, 3, -15, 15, -8, -8, 15, 32, 1, -2, 35,
+  -25, 47, 45, -23, 32, 2, 0, 15, -40, 22, 0, -2, -2, 1, 1, 3, -48, 51, 1, 42,
+  46, 40, 42, 16, 1, 0, 0, 32, 0, 109, 3, -84, 55, 90, -28, 60, 48, 0, 32, 0,
+  38, 0, -76, 60, 19, 32, 0, -1, 1, 35, 35, 35, 35, -28, -28, -28, -28, 16, 32, -9,
+  -1, 1, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 8,
+};
+const int8_t scrh[] PROGMEM = {  // 127 -> 74 bytes
+  -6, 0, -30, 1, 2, 3, 6, 32, -11, -1, 1, 27, -45, -5, -5, 20, 20, 37, 45, 116,
+  81, 83, 26, -37, -26, 8, 32, 1, -120, 1, 42, -20, -34, 32, 32, 1, -104, 0, 75, -8,
+  82, -48, 32, 1, -103, 0, 72, 41, -25, 72, -25, 32, 1, -35, 1, 19, 51, 100, 71, 45,
+  -31, -22, 8, 32, 1, -19, 0, 0, 45, 105, 105, 45, -45, -45,
+};
+const int8_t showOff[] PROGMEM = {  // 107 -> 60 bytes
+  -5, 0, 0, 1, 2, 3, 3, 32, 0, -1, 1, 20, 20, 30, 30, 30, 30, 30, 30, 8,
+  32, -62, -4, 0, 95, 42, 42, 92, 92, 56, 56, -52, -52, 32, 3, 0, 0, 7, 105, 32,
+  1, 0, 0, -7, 32, -61, -1, 0, 0, -10, 0, 0, 16, 16, 30, 30, 30, 30, 30, 30,
+};
+const int8_t snf[] PROGMEM = {  // 107 -> 88 bytes
+  -5, 0, 0, 1, 2, 3, 3, 32, 1, -1, 1, 40, 30, 30, 30, 30, 30, 30, 30, 30,
+  12, 32, 1, -1, 1, 9, 44, 44, 41, 41, -32, -32, 4, 4, 8, 32, -57, -1, 0, -4,
+  -7, 7, 14, 14, 74, 74, 52, 52, -26, -26, 20, 20, 32, -9, -4, 0, 12, -2, 2, 5,
+  5, 4, 4, 46, 46, -30, -30, 26, 26, 32, -9, -1, 0, 41, -9, 9, 0, 0, 18, 18,
+  30, 30, 48, 48, 48, 48, 12, 12,
+};
+const int8_t tbl[] PROGMEM = {  // 67 -> 48 bytes
+  -3, 0, 0, 1, 0, 1, 2, 32, 0, -1, 1, 40, 40, 40, 40, 27, 27, 27, 27, 4,
+  32, 1, -1, 0, 24, 53, 53, 53, 53, 2, 2, 2, 2, 32, 1, -1, 3, 94, 1, 1,
+  1, 1, 103, 103, 103, 103, 64, 50,
+};
+const int8_t toss[] PROGMEM = {  // 107 -> 95 bytes
+  -5, 0, 0, 1, 0, 0, 0, 32, -5, -1, 1, -74, 25, -120, 48, 27, -33, -12, 9, 5,
+  24, 23, 10, 17, 27, 28, 8, 32, -13, -1, 1, 12, 20, 28, 46, -14, -32, 37, 28, 81,
+  78, 12, 23, -18, -26, 80, 0, 60, 110, 10, 0, 24, 54, -6, -36, 28, 35, 104, 95, 19,
+  7, -56, -54, 0, 1, 0, 0, 32, 4, 0, 3, 120, 64, 2, 0, 0, -10, 0, 15, 0,
+  0, 0, 0, 16, 16, 30, 30, 30, 30, 30, 30, 8, 0, 0, 0,
+};
+const int8_t tossD[] PROGMEM = {  // 107 -> 91 bytes
+  -5, 0, 0, 2, 0, 0, 0, 32, 2, -1, 1, 23, 16, 16, 15, 15, -8, -8, 15, 15,
+  8, 0, 0, 90, 0, 0, -3, -3, 10, 10, 21, 21, 60, 60, 35, 35, -34, -34, 64, 4,
+  1, -50, 32, 6, -1, 15, 0, 25, -3, -3, 32, 32, 12, 12, 15, 15, 75, 1, 0, 0,
+  32, -10, -1, 3, 10, 0, 0, 0, 0, 0, -5, -5, 25, 25, 15, 15, -9, -9, 8, 0,
+  32, 2, -49, 0, -1, 6, 6, 17, 17, 13, 13,
+};
+const int8_t tossF[] PROGMEM = {  // 107 -> 79 bytes
+  -5, 0, 0, 1, 0, 0, 0, 32, 4, -1, 1, -100, 13, 13, 30, 30, 30, 30, 30, 30,
+  8, 32, -10, -1, 0, -10, -95, 10, 10, -20, -20, 25, 25, 10, 10, 5, 5, 54, 54, 32,
+  6, -1, 1, 75, -78, 2, 2, 75, 75, 78, 78, -37, -37, 90, 32, 6, 0, 1, 125, 0,
+  0, 32, -14, -1, 1, 0, 0, 0, 0, 0, 20, 20, 30, 30, 30, 30, 30, 30, 8,
+};
+const int8_t ts[] PROGMEM = {  // 47 -> 48 bytes
+  -2, 0, 0, 1, 0, 1, 2, 0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 32, 0, 0, 0, 32, -1, -1, 0, 75, 75, 75, 75, 75, 75, 75, 75,
+  75, 75, 75, 75, -55, -55, -55, -55,
+};
+const int8_t wh[] PROGMEM = {  // 67 -> 58 bytes
+  -3, 0, -30, 1, 0, 1, 2, 32, -57, -1, 1, 57, -20, 20, 40, 40, 33, 20, 62, 59,
+  46, 70, -15, -15, 48, 32, 5, 127, 0, -57, -20, 20, 33, 66, 62, 70, 46, -21, 32, -9,
+  -1, 1, 26, 0, -45, -5, -5, 20, 20, 45, 45, 105, 105, 45, 45, -45, -45, 32,
+};
+const int8_t zz[] PROGMEM = {  // 27 -> 12 bytes
+  -1, 0, 0, 1, 0, 0, 0, 32, 0, 0, 1, 4,
+};
+const char* skillNameWithType[] = {
+    "bdFI",     "bkI",      "bkArmFI", "bkArmLI", "bkFI",     "bkLI",    "carpetFI", "carpetLI", "crArmFI", "crArmLI",
+    "crFI",     "crLI",     "gpFI",    "gpLI",    "hlwI",     "jpFI",    "lftFI",    "lftLI",    "phFI",    "phLI",
+    "trArmFI",  "trArmLI",  "trFI",    "trLI",    "vtArmFI",  "vtFI",    "vtLI",     "wkArmFI",  "wkArmLI", "wkFI",
+    "wkLI",     "balanceI", "buttUpI", "calibI",  "droppedI", "liftedI", "lndI",     "restI",    "sitI",    "strI",
+    "upI",      "zeroN",    "angI",    "bfI",     "bxI",      "chrI",    "ckI",      "clapI",    "cmhI",    "dgI",
+    "dropRecI", "ffI",      "fivI",    "flipI",   "flipDI",   "flipFI",  "gdbI",     "hdsI",     "hgI",     "hiI",
+    "hskI",     "huI",      "huntI",   "jmpI",    "kcI",      "knockI",  "launchI",  "lpovI",    "luckyI",  "mwI",
+    "ndI",      "pdI",      "peeI",    "pickI",   "pickDI",   "pickFI",  "puI",      "pu1I",     "putI",    "putDI",
+    "putFI",    "rcI",      "rlI",     "scrhI",   "showOffI", "snfI",    "tblI",     "tossI",    "tossDI",  "tossFI",
+    "tsI",      "whI",      "zzI",
+};
+#if !defined(MAIN_SKETCH) || !defined(I2C_EEPROM)
+// if it's not the main sketch to save data or there's no external EEPROM,
+// the list should always contain all information.
+const int8_t* progmemPointer[] = {
+    bdF,     bk,  bkArmF, bkArmL,  bkF,    bkL,   carpetF, carpetL, crArmF,  crArmL, crF,    crL,  gpF,   gpL,
+    hlw,     jpF, lftF,   lftL,    phF,    phL,   trArmF,  trArmL,  trF,     trL,    vtArmF, vtF,  vtL,   wkArmF,
+    wkArmL,  wkF, wkL,    balance, buttUp, calib, dropped, lifted,  lnd,     rest,   sit,    str,  up,    zero,
+    ang,     bf,  bx,     chr,     ck,     clap,  cmh,     dg,      dropRec, ff,     fiv,    flip, flipD, flipF,
+    gdb,     hds, hg,     hi,      hsk,    hu,    hunt,    jmp,     kc,      knock,  launch, lpov, lucky, mw,
+    nd,      pd,  pee,    pick,    pickD,  pickF, pu,      pu1,     put,     putD,   putF,   rc,   rl,    scrh,
+    showOff, snf, tbl,    toss,    tossD,  tossF, ts,      wh,      zz,
+};
+#else  // only need to know the pointers to newbilities, because the intuitions have been saved onto external EEPROM,
+// while the newbilities on progmem are assigned to new addresses
+const int8_t* progmemPointer[] = {
+    zero,
+};
+#endif
+// the total byte of the raw instincts is 22425
+// the maximal array size is 933 bytes of wkF.
+// Make sure to leave enough memory for SRAM to work properly. Any single skill should be smaller than 400 bytes for
+// safety.
@@ -134,6 +134,7 @@ int Servo::attach(int pin, int range, int frequency, int minPulse, int maxPulse)
     // Set up this channel
     // if you want anything other than default timer width, you must call setTimerWidth() before attach
     pwm.attachPin(this->pinNumber, this->frequency, this->timer_width); // GPIO pin assigned to channel
+    this->committedTicks = -1; // the channel may be a different one now
                                                                         //        Serial.print(this->pinNumber);
                                                                         //        Serial.println("Attaching servo : "+String(pin)+" on PWM "+String(pwm.getChannel()));
 
@@ -148,6 +149,7 @@ void Servo::detach()
         pwm.detachPin(this->pinNumber);
 
         this->pinNumber = -1;
+        this->committedTicks = -1;
     }
 }
 
@@ -182,9 +184,21 @@ void Servo::writeMicroseconds(int value)
         this->ticks = value;
         // do the actual write
         pwm.write(this->ticks);
+        this->committedTicks = value;
     }
 }
 
+bool Servo::writeTicks(int value)
+{
+    // the batch output converts the pulse widths of a whole frame itself, and skips the channels that didn't change
+    if (!this->attached() || value == this->committedTicks)
+        return false;
+    this->ticks = value;
+    pwm.write(value);
+    this->committedTicks = value;
+    return true;
+}
+
 int Servo::read() // return the value as degrees
 {
     return (map(readMicroseconds() + 1, this->min, this->max, 0, angleRange));
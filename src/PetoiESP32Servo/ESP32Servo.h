@@ -157,6 +157,7 @@ public:
 	void detach();
 	void write(int value); // if value is < MIN_PULSE_WIDTH its treated as an angle, otherwise as pulse width in microseconds
 	void writeMicroseconds(int value);     // Write pulse width in microseconds
+	bool writeTicks(int value);            // Write pulse width in timer ticks. false if the channel already has it
 	int read(); // returns current pulse width as an angle between 0 and 180 degrees
 	int readMicroseconds(); // returns current pulse width in microseconds for this servo
 	bool attached(); // return true if this servo is attached, otherwise false
@@ -182,6 +183,7 @@ private:
 	int pinNumber = 0;                      // GPIO pin assigned to this channel
 	int timer_width = DEFAULT_TIMER_WIDTH; // ESP32 allows variable width PWM timers
 	int ticks = DEFAULT_PULSE_WIDTH_TICKS; // current pulse width on this channel
+	int committedTicks = -1;               // the ticks last written to the channel. -1 after attach or detach
 	int timer_width_ticks = DEFAULT_TIMER_WIDTH_TICKS; // no. of ticks at rollover; varies with width
 	ESP32PWM * getPwm(); // get the PWM object
 	ESP32PWM pwm;
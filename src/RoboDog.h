@@ -71,13 +71,24 @@ String uniqueName = "";
 // #define WIFI_MANAGER  // toggle WiFi Manager. It should be always off for now
 #define WEB_SERVER  // toggle web server
 // #define SHOW_FPS // toggle FPS display
+// #define PROFILER  // toggle the per-stage loop profiler. query with ?f or ?F
+// #define ALLOC_COUNTER  // toggle the debug check for heap allocations in the steady gait loop
+#define CONTROL_LOOP  // toggle the fixed-rate control task for IMU sampling, balance and servo output
+#define CONTROL_FREQ 200  // Hz. rate of the control task
+#define COMPRESSED_SKILLS  // toggle the compressed instinct skills generated by tools/compressSkills.py
+// #define PRECOMPILED_TICKS  // toggle the frames of gaits and postures converted to duty ticks when a skill is loaded
 
 #define SERVO_FREQ 240
+// #define PCA9685_SERVO  // toggle the servo output through a PCA9685 board on I2C instead of the ESP32 pins
 
 // Tutorial: https://bittle.petoi.com/11-tutorial-on-creating-new-skills
 
 #define MODEL "Bittle X"
+#ifdef COMPRESSED_SKILLS
+#include "InstinctBittleESPCompressed.h"
+#else
 #include "InstinctBittleESP.h"
+#endif
 #define REGULAR P1L
 #define KNEE P1L
 
@@ -161,6 +172,9 @@ bool newBoard = false;
 #define C_FOLLOW_OFF 'f'
 #define C_LEARN 'l'   // Should be named C_SERVO_FEEDBACK_LEARN since it is only associated with T_SERVO_FEEDBACK?
 #define C_REPLAY 'r'  // Should be named C_SERVO_FEEDBACK_REPLAY since it is only associated with T_SERVO_FEEDBACK?
+#define C_LEARN_SAVE 's'   // fs name: save the last recording under a name
+#define C_LEARN_LIST 'i'   // fi: list the saved recordings
+#define C_LEARN_SKILL 'k'  // fk [name]: load a recording as a skill and run it
 #define T_SERVO_FOLLOW 'F'  // make the other legs follow the moved legs
 
 #define T_GYRO 'g'          // gyro-related commands. by itself, is a toggle to turn on or off the gyro function
@@ -183,13 +197,16 @@ bool newBoard = false;
   'i'  // i jointIndex1 jointAngle1 jointIndex2 jointAngle2 ... e.g. i0 70 8 -20 9 -20. a single 'i' will free the head
        // joints if it were previously manually controlled.
 #define T_INDEXED_SIMULTANEOUS_BIN 'I'  // I jointIndex1 jointAngle1 jointIndex2 jointAngle2 ... e.g. I0 70 8 -20 9 -20
+#define T_GAIT_SYNTH 'E'  // E stride height duty frames phase0 phase1 phase2 phase3 [x z]. synthesize a gait and run it
+#define T_FOOT_BIN 'Y'  // Y leg1 x1 z1 leg2 x2 z2 ... feet in mm from the shoulders. e.g. Y0 0 70 1 0 70
 #define T_JOINTS 'j'  // A single "j" returns all angles. "j Index" prints the joint's angle. e.g. "j 8" or "j11".
 #define T_JOYSTICK 'J'
 #define T_SKILL 'k'
 #define T_SKILL_DATA 'K'
 #define T_BALANCE_SLOPE \
   'l'                     // change the slope of the balancing adjustment in roll and pitch directions. \
-                          // default "l 1 1". the numbers allows [-2,-1,0,1,2]
+                          // default "l 1 1". the numbers allows [-2,-1,0,1,2]. \
+                          // "lm 1" selects the PD balance, "lg kpR kdR kiR kpP kdP kiP" sets its gains
 #define T_LISTED_BIN 'L'  // a list of the DOFx joint angles: angle0 angle1 angle2 ... angle15
 #define T_INDEXED_SEQUENTIAL_ASC \
   'm'                     // m jointIndex1 jointAngle1 jointIndex2 jointAngle2 ... e.g. m0 70 0 -70 8 -20 9 -20
@@ -199,10 +216,11 @@ bool newBoard = false;
   'n'  // customize the Bluetooth device's broadcast name. e.g. nMyDog will name the device as "MyDog" \
        // it takes effect the next time the board boosup. it won't interrupt the current connecton.
 // #define T_MELODY 'o'
-#define T_SIGNAL_GEN 'o'  // signal generator for joint movements
-#define T_CPG 'r'         // Oscillator for Central Pattern Generator (ASCII)
-#define T_CPG_BIN 'Q'     // Oscillator for Central Pattern Generator (Binary)
-#define T_PAUSE 'p'       // pause
+#define T_SIGNAL_GEN 'o'   // signal generator for joint movements. it runs until another token, or "o" alone
+#define T_SIGNAL_WAVE 'O'  // upload a wave shape to the signal generator: slot s0 s1 ... s63 (binary)
+#define T_CPG 'r'          // Oscillator for Central Pattern Generator (ASCII)
+#define T_CPG_BIN 'Q'      // Oscillator for Central Pattern Generator (Binary)
+#define T_PAUSE 'p'        // pause
 #define T_TASK_QUEUE 'q'
 #define T_SAVE 's'
 #define T_TILT 't'
@@ -220,8 +238,12 @@ bool newBoard = false;
 #define T_RESET '!'
 #define T_QUERY '?'
 #define C_QUERY_PARTITION 'p'
+#define C_QUERY_CONTROL 'c'
+#define C_QUERY_PROFILE 'f'
+#define C_QUERY_PROFILE_BIN 'F'
 #define T_ACCELERATE '.'
 #define T_DECELERATE ','
+#define T_EASING 'e'  // e profile picks the easing of the transitions: 0 cosine, 1 linear, 2 cubic, 3 minimum jerk
 
 #define T_EXTENSION 'X'
 #define EXTENSION_GROVE_SERIAL 'S'  // connect to Grove UART2
@@ -253,7 +275,10 @@ byte batteryWarningCounter = 0;
 float lastVoltage;
 int uptime = -1;
 int frame = 0;
+float framePhase = 0;    // the position between frame and frame + 1, in [0, 1)
+float frameAdvance = 1;  // the frames a gait moves forward in the next perform()
 int tStep = 1;
+byte gaitBlendFrames = 8;  // frames of the crossfade between two gaits. 0 transforms to the new gait before playing it
 long loopTimer;
 byte fps = 0;
 // long wdtTimer;
@@ -264,6 +289,7 @@ int completedCycles = 0;         // Number of gait cycles completed so far
 bool cycleCountingMode = false;  // Whether cycle counting mode is active
 
 char token;
+bool skillAckQ = false;  // a k token waits for its transition to finish before it's echoed back
 char lastToken;
 char lowerToken;
 #define CMD_LEN 20
@@ -300,7 +326,6 @@ bool cmdFromWeb = false;
 // Other booleans
 bool interruptedDuringBehavior = false;
 bool workingStiffness = true;
-bool imuLockI2c = false;
 
 #define HEAD_GROUP_LEN 4  // used for controlling head pan, tilt, tail, and other joints independent from walking
 int targetHead[HEAD_GROUP_LEN];
@@ -347,6 +372,13 @@ int delayException = 5;
 int delayShort = 3;
 int delayPrevious;
 int runDelay = delayMid;
+// gaits are played from a continuous phase at a fixed output rate. the speed is a multiplier of the frame rate of
+// delayShort + delayMid ms per frame
+float gaitRate = 1;  // set by '.' and ','
+#define GAIT_RATE_MIN 0.25
+#define GAIT_RATE_MAX 4
+#define GAIT_RATE_STEP 1.2  // the factor of one '.' or ','
+#define GAIT_UPDATE_MS 5    // ms between two outputs of a gait, whatever the gait rate
 
 int8_t middleShift[] = {0, -90, 0, 0, -45, -45, -45, -45, 55, 55, -55, -55, -55, -55, -55, -55};
 
@@ -371,6 +403,7 @@ int previousAng[DOF] = {0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, -55, -55, -55, -
 
 int zeroPosition[DOF] = {};
 int calibratedZeroPosition[DOF] = {};
+bool tickFramesQ = false;  // the duty ticks of the skill frames are up to date (see Skill::compileTicks())
 
 int8_t servoCalib[DOF] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
@@ -378,11 +411,13 @@ int16_t mpuOffset[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 float expectedRollPitch[2];
 float RollPitchDeviation[2];
-float currentAdjust[DOF] = {};
+float adjustBuffer[2][DOF] = {};
+float* currentAdjust = adjustBuffer[0];  // the latest balance adjustment. updateAdjust() writes the other buffer
 int balanceSlope[2] = {1, 1};  // roll, pitch
 
-#include "QList/QList.h"
 #include "tools.h"
+#include "profiler.h"
+#include "allocCounter.h"
 #include "taskQueue.h"
 
 /* Dependencies for displayNsvPartition() */
@@ -393,6 +428,7 @@ int balanceSlope[2] = {1, 1};  // roll, pitch
 #include "nvs_flash.h"      // To check namespaces in the nvs partition of the ESP32
 
 #include <Wire.h>
+#include <LittleFS.h>  // the teach-mode recordings
 #include "configConstants.h"
 #include "bluetoothManager.h"
 #include "io.h"
@@ -403,9 +439,27 @@ int balanceSlope[2] = {1, 1};  // roll, pitch
 #ifdef IR_PIN
 #include "infrared.h"
 #endif
+#include "feedbackCapture.h"
+#include "servoOutput.h"
 #include "espServo.h"
 #include "moduleManager.h"
+#include "motionEngine.h"
+#include "balancePD.h"
+#include "balanceGain.h"
+#include "waveTable.h"
+#include "signalGenerator.h"
+#include "cpg.h"
+#include "kinematics.h"
+#include "gaitSynth.h"
+#include "learnLog.h"
+#include "motionOutput.h"
+#include "jointCommand.h"
 #include "motion.h"
+#include "controlClock.h"
+#include "controlLoop.h"
+#include "skillCodec.h"
+#include "skillIndex.h"
+#include "skillFrames.h"
 #include "skill.h"
 #ifdef WEB_SERVER
 #include "webServer.h"
@@ -448,9 +502,14 @@ void initRobot() {
   if (updateGyroQ) imuSetup();
 
   servoSetup();
+  balanceSetup();
+#ifdef CONTROL_LOOP
+  controlLoopSetup();
+#endif
   lastCmd[0] = '\0';
   newCmd[0] = '\0';
   skill = new Skill();
+  previousGait = new Skill();
   skillList = new SkillList();
 
 #ifdef IR_PIN
@@ -475,8 +534,12 @@ void initRobot() {
     if (imuException != 0) {
       waitForImuConvergence();
       // Re-read IMU data and check for exceptions after convergence
+#ifdef CONTROL_LOOP
+      waitForImuSample();  // the control task owns the IMU and updates imuException on every sample
+#else
       readIMU();
       getImuException();
+#endif
     }
     print6Axis();
     tQueue->addTask((imuException) ? T_SERVO_CALIBRATE : T_REST, "");
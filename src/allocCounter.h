@@ -0,0 +1,53 @@
+/* Debug allocation counter.
+
+   The heap is shared with WiFi and BLE, so the steady loop of a gait should not allocate at all. With ALLOC_COUNTER
+   defined, the global operator new counts the calls made by the loop task, and ALLOC_CHECK() at the top of reaction()
+   complains if anything was allocated during a loop that ran a gait without any new command. In a host build (no
+   ARDUINO) it ends the program with a failure instead, so the host test fails.
+   Only operator new and new[] are counted. String and malloc() calls are not.
+*/
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#ifdef ALLOC_COUNTER
+uint32_t allocCount = 0;  // allocations by the loop task since the last check
+
+void* countedAlloc(size_t size) {
+  if (xPortGetCoreID() == PROFILE_CORE) allocCount++;
+  void* p = malloc(size);
+  if (p == NULL) abort();
+  return p;
+}
+void* operator new(size_t size) {
+  return countedAlloc(size);
+}
+void* operator new[](size_t size) {
+  return countedAlloc(size);
+}
+void operator delete(void* p) noexcept {
+  free(p);
+}
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void checkAllocations(bool steadyQ) {  // call once per loop
+  static bool steadyBeforeQ = false;  // the window since the last check started in a steady gait loop
+  if (steadyQ && steadyBeforeQ && allocCount) {
+    PTF("ALLOC ");
+    PT(allocCount);
+    PTLF(" allocation(s) in the steady gait loop!");
+#ifndef ARDUINO
+    fprintf(stderr, "ALLOC %u allocation(s) in the steady gait loop!\n", unsigned(allocCount));
+    exit(EXIT_FAILURE);
+#endif
+  }
+  steadyBeforeQ = steadyQ;
+  allocCount = 0;
+}
+#define ALLOC_CHECK(steadyQ) checkAllocations(steadyQ)
+#else
+#define ALLOC_CHECK(steadyQ)
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+/* The balance gain matrix and the adjustment step of the joints.
+
+   The balance adjustment of a joint is linear in the roll and pitch deviations, except that the legs on the lower
+   side push harder and some joints follow |roll|. Both only depend on the sign of the roll, so the gains are kept per
+   roll sign: roll[i][0] for a positive roll deviation, roll[i][1] for a negative one. setup() must run again after
+   balanceSlope changes. step() moves every joint from the previous adjustment toward the ideal one in one pass, into a
+   separate vector, so updateAdjust() (motion.h) can publish it at once.
+
+   Like balancePD.h, there is no Arduino dependency, so a host build can check it against the per joint adjust() it
+   replaced.
+*/
+#ifndef BALANCE_GAIN_H
+#define BALANCE_GAIN_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+class BalanceGain {
+ public:
+  float roll[DOF][2];  // degrees of adjustment per degree of roll deviation, per roll sign
+  float pitch[DOF];    // degrees of adjustment per degree of pitch deviation
+
+  // adaptive holds the roll and pitch coefficients of each joint, slope the roll and pitch direction (balanceSlope)
+  void setup(const float (*adaptive)[2], const int* slope, float leftRightFactor, float walkingFactor) {
+    const float radPerDeg = M_PI / 180;
+    for (uint8_t i = 0; i < DOF; i++) {
+      for (uint8_t side = 0; side < 2; side++) {
+        float rollSign = side ? -1 : 1;
+        float gain = adaptive[i][0];
+        if (i == 1 || i > 3) {
+          bool leftQ = (i - 1) % 4 > 1 ? true : false;
+          if ((leftQ && slope[0] * rollSign > 0) || (!leftQ && slope[0] * rollSign < 0))
+            gain *= leftRightFactor * abs(slope[0]);
+          if (i == 1 || i > 7) gain *= rollSign;  // these joints follow |roll|
+        }
+        roll[i][side] = radPerDeg * (i > 3 ? walkingFactor : 1) * slope[0] * gain;
+      }
+      pitch[i] = -radPerDeg * slope[1] * adaptive[i][1];
+    }
+  }
+
+  // the adjustment of joints first ~ DOF - 1 for the deviations rollDev and pitchDev, moved from the previous one by
+  // damper at most. the pitch deviation is cut at cutOff. the joints before first are copied
+  void step(const float* from, float* to, float rollDev, float pitchDev, float cutOff, float damper,
+            uint8_t first) const {
+    pitchDev = pitchDev > cutOff ? cutOff : (pitchDev < -cutOff ? -cutOff : pitchDev);
+    uint8_t side = rollDev < 0;
+    for (uint8_t i = 0; i < DOF; i++) {
+      float a = from[i];
+      if (i >= first) {
+        float idealAdjust = roll[i][side] * rollDev + pitch[i] * pitchDev;
+        float change = idealAdjust - a;
+        a += change > damper ? damper : (change < -damper ? -damper : change);
+        float thres = (i > 3 && i % 4 < 2) ? 15 : 45;
+        a = a > thres ? thres : (a < -45 ? -45 : a);
+      }
+      to[i] = a;
+    }
+  }
+};
+
+#endif
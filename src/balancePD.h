@@ -0,0 +1,60 @@
+/* PD balance controller of one body axis (roll or pitch).
+
+   The default balance (BALANCE_P) moves the joints in proportion to the roll and pitch deviation, through a slew
+   limit of ADJUSTMENT_DAMPER per IMU sample. It reacts late, and it oscillates when the gait runs fast. BALANCE_PD
+   feeds each deviation through a BalanceAxis first:
+     output = kp * deviation + kd * rate + ki * integral(deviation)
+   rate is the angular velocity of the axis from the gyro, so the correction starts before the deviation grows. The
+   small integral term removes the constant deviation on a slope.
+   - anti-windup: the integral stops growing while the output is saturated in the same direction, and the integral
+     term alone is capped by iLimit
+   - output limiting: the output is capped by the limit passed to update()
+   The output replaces the deviation as the input of the balance gain matrix (see updateAdjust() in motion.h).
+
+   Like controlClock.h, there is no Arduino dependency. The caller passes the time step, so a host build can run the
+   controller against a simulated body.
+*/
+#ifndef BALANCE_PD_H
+#define BALANCE_PD_H
+
+class BalanceAxis {
+ public:
+  float kp;        // 1
+  float kd;        // s
+  float ki;        // 1/s
+  float iLimit;    // the largest integral term, in degrees
+  float integral;  // degree * s
+
+  BalanceAxis() {
+    setGains(1, 0, 0);
+    iLimit = 10;
+  }
+
+  void setGains(float p, float d, float i) {
+    kp = p;
+    kd = d;
+    ki = i;
+    reset();
+  }
+
+  void reset() {
+    integral = 0;
+  }
+
+  float update(float deviation, float rate, float dt, float limit) {  // deviation in degrees, rate in degrees/s
+    float output = kp * deviation + kd * rate + ki * integral;
+    bool saturatedQ = (output >= limit && deviation > 0) || (output <= -limit && deviation < 0);
+    if (!saturatedQ && ki != 0) {
+      integral += deviation * dt;
+      float iMax = iLimit / (ki > 0 ? ki : -ki);
+      if (integral > iMax)
+        integral = iMax;
+      else if (integral < -iMax)
+        integral = -iMax;
+    }
+    output = kp * deviation + kd * rate + ki * integral;
+    return output > limit ? limit : (output < -limit ? -limit : output);
+  }
+};
+
+#endif
@@ -217,6 +217,7 @@ void configSetup() {
 void saveCalib(int8_t* var) {
   config.putBytes("calib", var, DOF);
   for (byte s = 0; s < DOF; s++) { calibratedZeroPosition[s] = zeroPosition[s] + float(var[s]) * rotationDirection[s]; }
+  tickFramesQ = false;
 }
 
 // clang-format off
@@ -0,0 +1,80 @@
+/* Period and deadline bookkeeping of the fixed-rate control loop.
+
+   Every tick of the control task calls start() when it wakes up and finish() when its work is done. The clock keeps
+   the expected start of each tick on a fixed grid, so a late tick does not shift the following ones. It counts:
+   - jitter: how late a tick started compared to the grid
+   - execution time: from start() to finish()
+   - missed deadlines: ticks whose work was not done before the next tick was due, plus ticks that never ran because
+     the task woke up more than one period late
+
+   Like the motion engine, the clock has no Arduino dependency. The caller passes the time in microseconds, so a host
+   build can drive it with a simulated clock to check the period stability of the scheduler (see controlLoop.h).
+*/
+#ifndef CONTROL_CLOCK_H
+#define CONTROL_CLOCK_H
+
+#include <stdint.h>
+
+class ControlClock {
+ public:
+  uint32_t period;     // in us
+  uint32_t ticks;      // ticks that ran since begin()
+  uint32_t missed;     // missed deadlines since the last reset()
+  uint32_t jitterMax;  // in us
+  uint32_t execMax;    // in us
+  uint64_t jitterSum;  // in us. jitterSum / samples is the average jitter
+  uint32_t samples;    // ticks since the last reset()
+  int64_t next;        // expected start of the next tick
+  int64_t tickStart;
+  int64_t deadline;
+
+  ControlClock() {
+    period = 0;
+    ticks = 0;
+    next = tickStart = deadline = 0;
+    reset();
+  }
+
+  void begin(int64_t firstTick, uint32_t p) {  // firstTick is the time at which the first tick is expected
+    period = p;
+    ticks = 0;
+    next = firstTick;
+    reset();
+  }
+
+  void reset() {  // clear the statistics. the tick counter keeps running
+    missed = 0;
+    jitterMax = execMax = 0;
+    jitterSum = 0;
+    samples = 0;
+  }
+
+  void start(int64_t now) {
+    int64_t late = now - next;
+    if (late < 0)  // woke up early. count it as jitter all the same
+      late = -late;
+    else if (late >= period) {  // one or more ticks were skipped. move the grid to the tick that is running now
+      uint32_t skipped = late / period;
+      missed += skipped;
+      next += int64_t(skipped) * period;
+      late -= int64_t(skipped) * period;
+    }
+    if (late > jitterMax) jitterMax = late;
+    jitterSum += late;
+    samples++;
+    tickStart = now;
+    deadline = next + period;
+    next = deadline;
+    ticks++;
+  }
+
+  void finish(int64_t now) {
+    uint32_t exec = now - tickStart;
+    if (exec > execMax) execMax = exec;
+    if (now > deadline) missed++;
+  }
+
+  uint32_t jitterAvg() { return samples ? jitterSum / samples : 0; }
+};
+
+#endif
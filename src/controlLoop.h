@@ -0,0 +1,114 @@
+/* Fixed-rate control loop.
+
+   Gait frames used to be paced by delay() calls in reaction(), Skill::perform() and CPG::sendSignal(), so the real
+   frame rate depended on whatever else loop() did in the same iteration. An esp_timer now wakes a dedicated task on
+   core 0 at CONTROL_FREQ. Each tick does, in this order:
+   1. IMU sampling (it replaces taskIMU)
+   2. the balance adjustment of the walking joints for the running posture or gait
+   3. one step of the motion engine to the servos
+   loop() only submits frames to the motion engine and waits for control ticks instead of milliseconds.
+
+   The jitter, execution time and missed deadlines are kept in controlClock (controlClock.h). "?c" prints and resets
+   them.
+*/
+
+#ifdef CONTROL_LOOP
+#include "esp_timer.h"
+
+ControlClock controlClock;
+esp_timer_handle_t controlTimer = NULL;
+
+int controlTicks(int ms) {  // round a delay in ms to control ticks
+  return (ms * CONTROL_FREQ + 500) / 1000;
+}
+
+void updateBalance() {  // the roll and pitch deviation of the latest IMU sample decides the adjustment of the joints
+  for (byte i = 0; i < 2; i++) {
+    RollPitchDeviation[i] = ypr[2 - i] - expectedRollPitch[i];  // all in degrees
+    RollPitchDeviation[i] = sign(ypr[2 - i]) * max(float(fabs(RollPitchDeviation[i]) - levelTolerance[i]), float(0)) +
+                            yprTilt[2 - i];  // filter out small angles
+  }
+  updateAdjust(periodGlobal == 1);
+}
+
+void controlTimerCallback(void* parameter) {  // runs in the esp_timer task. the work is done by taskControl
+  xTaskNotifyGive(TASK_control);
+}
+
+void taskControl(void* parameter) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    controlClock.start(esp_timer_get_time());
+    if (updateGyroQ) {
+      imuUpdated = readIMU();
+      getImuException();
+      if (imuUpdated && gyroBalanceQ && tolower(token) == T_SKILL && periodGlobal > 0) updateBalance();
+    }
+    motionTick();
+    controlClock.finish(esp_timer_get_time());
+  }
+}
+
+void controlLoopSetup() {
+  xTaskCreatePinnedToCore(taskControl,    // task function
+                          "TaskControl",  // task name
+                          4096,           // task stack size
+                          NULL,           // parameters
+                          3,              // priority. higher than the other tasks on core 0
+                          &TASK_control,  // handle
+                          0);             // core
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = &controlTimerCallback;
+  timerArgs.name = "control";
+  esp_timer_create(&timerArgs, &controlTimer);
+  controlClock.begin(esp_timer_get_time() + 1000000 / CONTROL_FREQ, 1000000 / CONTROL_FREQ);
+  esp_timer_start_periodic(controlTimer, 1000000 / CONTROL_FREQ);
+  PTF("Control loop at ");
+  PT(CONTROL_FREQ);
+  PTLF(" Hz");
+}
+
+void printControlClock() {
+  char message[100];
+  sprintf(message, "%dHz ticks %u missed %u jitter avg %u max %u us exec max %u us", CONTROL_FREQ, controlClock.ticks,
+          controlClock.missed, controlClock.jitterAvg(), controlClock.jitterMax, controlClock.execMax);
+  printToAllPorts(message);
+  controlClock.reset();
+}
+
+// gait frames are due on the grid of control ticks
+uint32_t nextFrameTick = 0;
+bool frameDue() {
+  return int32_t(controlClock.ticks - nextFrameTick) >= 0;
+}
+void scheduleFrame(int ms) {
+  int interval = max(1, controlTicks(ms));
+  if (int32_t(controlClock.ticks - nextFrameTick) > interval)  // fell behind by more than a frame. start a new grid
+    nextFrameTick = controlClock.ticks;
+  nextFrameTick += interval;
+}
+
+void controlDelay(int ms) {  // block for a number of control ticks
+  uint32_t until = controlClock.ticks + controlTicks(ms);
+  while (int32_t(controlClock.ticks - until) < 0) delay(1);
+}
+
+// the control task owns the IMU. a second reader of the MPU FIFO on the loop task would corrupt the DMP packets, so
+// the loop task waits for the next sample instead of calling readIMU()
+void waitForImuSample(int timeout = 100) {
+  uint32_t until = controlClock.ticks + controlTicks(timeout);
+  imuUpdated = false;
+  while (!imuUpdated && int32_t(controlClock.ticks - until) < 0) delay(1);
+  controlDelay(1000 / CONTROL_FREQ);  // getImuException() runs right after the sample in the same tick
+}
+#else
+bool frameDue() {
+  return true;
+}
+void scheduleFrame(int ms) {
+  delay(ms);
+}
+void controlDelay(int ms) {
+  delay(ms);
+}
+#endif
@@ -0,0 +1,143 @@
+/* Central pattern generator of the shoulders.
+
+   The CPG streams one output per call of tick() from a continuous phase, so it never blocks the loop. A cycle has
+   _nSample base samples of -cos(), read from the shared table in waveTable.h. The legs stride through them by
+   _skipStep[0] samples per tick in the support stage and _skipStep[1] in the swing stage, so the position of a leg is
+   a piecewise linear function of time (position()). Each leg runs at its own time offset, from its phase. The
+   parameters can change in the middle of a cycle: the time keeps running, and the legs chase their new offsets within
+   CPG_OFFSET_SLEW.
+
+   Like signalGenerator.h, there is no Arduino dependency. tick() returns the angles, and cpgTick() in motion.h sends
+   them through the motion engine.
+*/
+#ifndef CPG_H
+#define CPG_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define CPG_OFFSET_SLEW 0.5  // the fraction of a tick by which a leg can lead or lag per tick after a phase change
+
+class CPG {
+ private:
+  int _nSample;
+  int edge;
+  float supportStart, supportEnd;  // the support stage in base samples
+  float cycle;                     // ticks of a cycle
+  float time;                      // ticks since the start of the cycle of a leg with phase 0
+  float offset[4];                 // ticks by which each leg leads
+  float targetOffset[4];
+  bool startedQ;
+  int8_t _amplitude;
+  int8_t _sideRatio;  // left/right x 10
+  int8_t _stateSwitchAngle;
+  int8_t _loopDelay;
+  int8_t _phase[4];   // range 100
+ public:
+  int8_t _midShift[2];
+  int8_t _skipStep[2];
+  CPG(int nSample, int8_t skipStep[]) {
+    waveSetup();
+    time = 0;
+    startedQ = false;
+    _amplitude = _sideRatio = _stateSwitchAngle = 0;
+    _loopDelay = 1;
+    _midShift[0] = _midShift[1] = 0;
+    for (byte l = 0; l < 4; l++) _phase[l] = offset[l] = 0;
+    cycle = 0;
+    setSteps(nSample, skipStep);
+  }
+
+  void setSteps(int nSample, int8_t skipStep[]) {  // the legs keep their positions in the cycle
+    bool keepQ = cycle > 0;
+    float p0 = 0, p[4];
+    if (keepQ) {
+      p0 = position(time) / _nSample;
+      for (byte l = 0; l < 4; l++) p[l] = position(time + offset[l]) / _nSample;
+    }
+    _nSample = nSample;
+    _skipStep[0] = max(int8_t(1), skipStep[0]);
+    _skipStep[1] = max(int8_t(1), skipStep[1]);
+    edge = _nSample * 0.05;
+    supportStart = edge;
+    supportEnd = _nSample / 2 - edge;
+    cycle = supportStart / _skipStep[1] + (supportEnd - supportStart) / _skipStep[0] +
+            (_nSample - supportEnd) / _skipStep[1];
+    if (keepQ) time = timeAt(p0 * _nSample);
+    for (byte l = 0; l < 4; l++) {
+      if (keepQ) offset[l] = timeAt(p[l] * _nSample) - time;
+      targetOffset[l] = timeAt(fmod(_phase[l] / 100.0, 1) * _nSample);
+    }
+  }
+
+  float position(float t) {  // the base sample reached at time t by a leg with phase 0
+    t = fmod(t, cycle);
+    if (t < 0) t += cycle;
+    float swing1 = supportStart / _skipStep[1];
+    float support = (supportEnd - supportStart) / _skipStep[0];
+    if (t < swing1) return t * _skipStep[1];
+    if (t < swing1 + support) return supportStart + (t - swing1) * _skipStep[0];
+    return supportEnd + (t - swing1 - support) * _skipStep[1];
+  }
+
+  float legPhase(uint8_t l) {  // where leg l is in the cycle, 0 ~ 1
+    return position(time + offset[l]) / _nSample;
+  }
+
+  float timeAt(float p) {  // the inverse of position()
+    if (p < supportStart) return p / _skipStep[1];
+    if (p < supportEnd) return supportStart / _skipStep[1] + (p - supportStart) / _skipStep[0];
+    return supportStart / _skipStep[1] + (supportEnd - supportStart) / _skipStep[0] + (p - supportEnd) / _skipStep[1];
+  }
+
+  void setPar(int8_t amplitude, int8_t sideRatio, int8_t stateSwitchAngle, int8_t loopDelay, int8_t midShift[],
+              int8_t phase[]) {
+    _amplitude = amplitude;
+    _sideRatio = sideRatio;
+    _stateSwitchAngle = stateSwitchAngle;
+    _loopDelay = loopDelay;
+    _midShift[0] = midShift[0];
+    _midShift[1] = midShift[1];
+    for (byte l = 0; l < 4; l++) {
+      _phase[l] = phase[l];
+      targetOffset[l] = timeAt(fmod(_phase[l] / 100.0, 1) * _nSample);
+      if (!startedQ) offset[l] = targetOffset[l];
+    }
+  }
+
+  // one output of the four shoulders into out and activeQ, indexed by joint. call it every GAIT_UPDATE_MS
+  void tick(float* out, bool* activeQ) {
+    startedQ = true;
+    float leftRatio = _sideRatio > 0 ? 1 : (10 + _sideRatio) / 10.0;
+    float rightRatio = _sideRatio > 0 ? (10 - _sideRatio) / 10.0 : 1;
+    float advance = float(GAIT_UPDATE_MS) / max(int8_t(1), _loopDelay);  // a tick used to be _loopDelay ms
+    for (byte l = 0; l < 4; l++) {
+      float d = fmod(targetOffset[l] - offset[l], cycle);  // the shorter way around the cycle
+      if (d > cycle / 2)
+        d -= cycle;
+      else if (d < -cycle / 2)
+        d += cycle;
+      float slew = advance * CPG_OFFSET_SLEW;
+      offset[l] += max(-slew, min(slew, d));
+      float p = position(time + offset[l]);
+      float ratio = (l % 3 ? rightRatio : leftRatio);
+      uint16_t wavePhase = uint16_t(int32_t(p * (65536.0f / _nSample))) - WAVE_QUARTER;  // -cos() is sin() 1/4 back
+      float angle = _amplitude * ratio * waveSine(wavePhase) / WAVE_ONE;
+      if (p > supportStart && p < supportEnd) angle += _stateSwitchAngle;  // not affected by ratio
+      out[8 + l] = angle + _midShift[l < 2 ? 0 : 1];
+      activeQ[8 + l] = true;
+    }
+    time = fmod(time + advance, cycle);
+  }
+  void printCPG() {
+    printToAllPorts("Amp\tside\tswitch\tShiftF\tShiftB\tdelay\tSupport\tSwing\tPhase");
+    char message[50];
+    sprintf(message, "%d\t%0.1f\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d", _amplitude, _sideRatio / 10.0,
+            _stateSwitchAngle, _midShift[0], _midShift[1], _loopDelay, _skipStep[0], _skipStep[1], _phase[0], _phase[1],
+            _phase[2], _phase[3]);
+    printToAllPorts(message);
+  }
+};
+
+#endif
@@ -0,0 +1,116 @@
+/* Angle to duty tables of the servo models.
+
+   Servo::write() maps an angle to a pulse width with map(), then usToTicks() turns the width into the ticks of the
+   duty in float. The models (espServo.h) have fixed angle and pulse ranges, and the frequency is SERVO_FREQ, so
+   DutyTable computes the whole conversion at compile time: tick[h] is the duty of h / 2 degrees of the servo (half
+   degrees, 0 ~ 2 * angleRange), in the ticks of the servo output (servoOutput.h)
+     LEDC     2^DEFAULT_TIMER_WIDTH ticks per period, the same as usToTicks()
+     PCA9685  4096 ticks per period at the prescale that Adafruit_PWMServoDriver::setPWMFreq() picks
+   The even entries are the integer degrees of map(), the odd ones are between them. The write path of a frame is one
+   lookup per joint.
+
+   The tables are built by C++11 constexpr functions over an index pack, so they live in flash and cost no setup.
+   ServoTicks points a servo at the table of its model. JointTicks keeps a walking joint in ticks for the frames
+   compiled when a skill is loaded (Skill::compileTicks() in skill.h), so a frame is an interpolation, the balance
+   times a gain and a clamp per joint.
+*/
+#ifndef DUTY_TABLE_H
+#define DUTY_TABLE_H
+
+#include <stdint.h>
+
+#ifdef PCA9685_SERVO
+constexpr uint32_t dutyTicks(uint64_t us, uint32_t den, int freq) {  // of us / den microseconds
+  return us * PCA9685_OSCILLATOR / (1000000ULL * den * (pca9685Prescale(freq) + 1));
+}
+#else
+constexpr uint32_t dutyTicks(uint64_t us, uint32_t den, int freq) {
+  return (us << DEFAULT_TIMER_WIDTH) * freq / (1000000ULL * den);
+}
+#endif
+
+// an integer degree truncates the pulse width to a microsecond like map(). half a degree keeps the fraction
+constexpr uint16_t halfDegreeDuty(int h, int range, int freq, int minUs, int maxUs) {
+  return h % 2 ? dutyTicks(uint64_t(minUs) * 2 * range + uint64_t(h) * (maxUs - minUs), 2 * range, freq)
+               : dutyTicks(minUs + long(h / 2) * (maxUs - minUs) / range, 1, freq);
+}
+
+template <int... H>
+struct DutyIndex {};
+template <int N, int... H>
+struct MakeDutyIndex : MakeDutyIndex<N - 1, N - 1, H...> {};
+template <int... H>
+struct MakeDutyIndex<0, H...> {
+  typedef DutyIndex<H...> type;
+};
+
+// the same parameters as ServoModel: angleRange, frequency, minPulse, maxPulse
+template <int RANGE, int FREQ, int MIN_US, int MAX_US, class I = typename MakeDutyIndex<2 * RANGE + 1>::type>
+struct DutyTable;
+
+template <int RANGE, int FREQ, int MIN_US, int MAX_US, int... H>
+struct DutyTable<RANGE, FREQ, MIN_US, MAX_US, DutyIndex<H...> > {
+  static constexpr uint16_t tick[sizeof...(H)] = {halfDegreeDuty(H, RANGE, FREQ, MIN_US, MAX_US)...};
+};
+
+template <int RANGE, int FREQ, int MIN_US, int MAX_US, int... H>
+constexpr uint16_t DutyTable<RANGE, FREQ, MIN_US, MAX_US, DutyIndex<H...> >::tick[sizeof...(H)];
+
+// the conversion of Servo::write() from an angle of the servo (0 ~ range) to duty ticks, a lookup in the table of the
+// model, so the batch output (servoFrame() in motionOutput.h) can convert a whole frame in one pass
+struct ServoTicks {
+  int16_t range;
+  const uint16_t* duty;  // DutyTable::tick, in half degrees
+  uint32_t gain;         // ticks per us in Q16 of the servo output
+};
+
+inline int tableTicks(const ServoTicks& t, int half) {  // Servo::usToTicks(map(half / 2.0, 0, range, min, max))
+  half = half < 0 ? 0 : (half > 2 * t.range ? 2 * t.range : half);
+  return t.duty[half];
+}
+
+// the ticks of the joint angle a, at half a degree, on a servo with the calibrated zero position and the rotation
+// direction of the joint
+inline int angleTicks(const ServoTicks& t, int zero, int direction, float a) {
+  return tableTicks(t, int(2 * (zero + a * direction)));
+}
+
+inline float tableTicksPerDegree(const ServoTicks& t) {  // the slope of the table
+  return float(t.duty[2 * t.range] - t.duty[0]) / t.range;
+}
+
+struct JointTicks {
+  int zero;         // ticks of angle 0
+  float perDegree;  // ticks of one degree of the joint, with its direction
+  int limit[2];     // ticks of angleLimit, lower first
+};
+
+inline JointTicks tickJoint(const ServoTicks& t, int zero, int direction, const int* angleLimit) {
+  JointTicks j;
+  j.zero = tableTicks(t, 2 * zero);
+  j.perDegree = tableTicksPerDegree(t) * direction;
+  for (int i = 0; i < 2; i++) j.limit[i] = tableTicks(t, 2 * (zero + angleLimit[i] * direction));
+  if (j.limit[0] > j.limit[1]) {
+    int temp = j.limit[0];
+    j.limit[0] = j.limit[1];
+    j.limit[1] = temp;
+  }
+  return j;
+}
+
+// the ticks of the integer angle a of a frame, before the limits, which are applied after the balance. beyond the
+// table it's extrapolated with the slope, so the balance may still bring it back
+inline uint16_t frameTicks(const ServoTicks& t, const JointTicks& j, int zero, int direction, int a) {
+  int degree = zero + a * direction;
+  if (degree >= 0 && degree <= t.range) return t.duty[2 * degree];
+  int tick = int(j.zero + a * j.perDegree);
+  return tick < 0 ? 0 : (tick > 65535 ? 65535 : tick);
+}
+
+// the ticks between two frames at phase / 256, plus the balance adjustment in degrees, within the limits
+inline int blendTicks(const JointTicks& j, uint16_t from, uint16_t to, int32_t phase, float adjust) {
+  int tick = from + (((int(to) - from) * phase) >> 8) + int(adjust * j.perDegree);
+  return tick < j.limit[0] ? j.limit[0] : (tick > j.limit[1] ? j.limit[1] : tick);
+}
+
+#endif
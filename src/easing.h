@@ -0,0 +1,57 @@
+/* Fixed-point easing tables.
+
+   The transitions used to compute (1 + cos(M_PI * s / steps)) / 2 in double precision for every joint and every step.
+   The easing curves are now sampled once into tables of EASE_TABLE_LEN + 1 entries in Q15 (EASE_ONE is 1.0), and a
+   step only needs a table lookup and an integer multiply-add for the linear interpolation between two entries.
+
+   The phase of a trajectory is in Q24: 0 is the start and EASE_PHASE_ONE is the end. Stepping through a trajectory of n
+   steps adds easePhaseStep(n) to the phase at each step, so the division is done once per trajectory.
+
+   Profiles (all go from 0 to EASE_ONE):
+   - EASE_COSINE:   (1 - cos(pi x)) / 2, the default
+   - EASE_LINEAR:   x
+   - EASE_CUBIC:    3x^2 - 2x^3
+   - EASE_MIN_JERK: 10x^3 - 15x^4 + 6x^5, the minimum jerk trajectory
+*/
+#ifndef EASING_H
+#define EASING_H
+
+#include <math.h>
+#include <stdint.h>
+
+enum EasingProfile { EASE_COSINE, EASE_LINEAR, EASE_CUBIC, EASE_MIN_JERK, EASE_PROFILE_NUM };
+
+#define EASE_TABLE_BITS 8
+#define EASE_TABLE_LEN (1 << EASE_TABLE_BITS)
+#define EASE_ONE 32768  // 1.0 in Q15
+#define EASE_PHASE_BITS 24
+#define EASE_PHASE_ONE (1UL << EASE_PHASE_BITS)
+#define EASE_FRAC_BITS 8  // bits of the phase used for the interpolation between two entries
+
+uint16_t easeTable[EASE_PROFILE_NUM][EASE_TABLE_LEN + 1];
+
+void easingSetup() {  // sample the curves. it only needs to run once
+  static bool readyQ = false;
+  if (readyQ) return;
+  for (int i = 0; i <= EASE_TABLE_LEN; i++) {
+    double x = double(i) / EASE_TABLE_LEN;
+    double curve[EASE_PROFILE_NUM] = {(1 - cos(M_PI * x)) / 2, x, x * x * (3 - 2 * x),
+                                      x * x * x * (10 + x * (-15 + 6 * x))};
+    for (int p = 0; p < EASE_PROFILE_NUM; p++) easeTable[p][i] = uint16_t(round(curve[p] * EASE_ONE));
+  }
+  readyQ = true;
+}
+
+inline uint32_t easePhaseStep(int steps) {  // the phase increment of one step
+  return steps > 0 ? (EASE_PHASE_ONE + steps / 2) / steps : EASE_PHASE_ONE;
+}
+
+inline int32_t ease(uint8_t profile, uint32_t phase) {  // the progress at a phase, in Q15
+  uint32_t idx = phase >> (EASE_PHASE_BITS - EASE_TABLE_BITS);
+  if (idx >= EASE_TABLE_LEN) return EASE_ONE;
+  const uint16_t* t = easeTable[profile] + idx;
+  int32_t frac = (phase >> (EASE_PHASE_BITS - EASE_TABLE_BITS - EASE_FRAC_BITS)) & ((1 << EASE_FRAC_BITS) - 1);
+  return t[0] + (((int32_t(t[1]) - t[0]) * frac) >> EASE_FRAC_BITS);
+}
+
+#endif
@@ -1,10 +1,22 @@
 #include "PetoiESP32Servo/ESP32Servo.h"
 #include "esp32-hal-adc.h"
+#ifdef PCA9685_SERVO
+#include "Adafruit-PWM-Servo-Driver-Library/Adafruit_PWMServoDriver.h"
+#endif
+#include "dutyTable.h"
 //------------------angleRange  frequency  minPulse  maxPulse;
-ServoModel servoG41(180, SERVO_FREQ, 500, 2500);
-ServoModel servoP1S(290, SERVO_FREQ, 500, 2500);  // 1s/4 = 250ms 250ms/2500us=100Hz
-ServoModel servoP1L(270, SERVO_FREQ, 500, 2500);
-ServoModel servoP50(120, SERVO_FREQ, 900, 2100);
+#define SERVO_G41 180, SERVO_FREQ, 500, 2500
+#define SERVO_P1S 290, SERVO_FREQ, 500, 2500  // 1s/4 = 250ms 250ms/2500us=100Hz
+#define SERVO_P1L 270, SERVO_FREQ, 500, 2500
+#define SERVO_P50 120, SERVO_FREQ, 900, 2100
+ServoModel servoG41(SERVO_G41);
+ServoModel servoP1S(SERVO_P1S);
+ServoModel servoP1L(SERVO_P1L);
+ServoModel servoP50(SERVO_P50);
+typedef DutyTable<SERVO_G41> dutyG41;  // see dutyTable.h
+typedef DutyTable<SERVO_P1S> dutyP1S;
+typedef DutyTable<SERVO_P1L> dutyP1L;
+typedef DutyTable<SERVO_P50> dutyP50;
 
 #define P_STEP 32
 #define P_BASE 3000 + 3 * P_STEP  // 3000~3320
@@ -28,20 +40,74 @@ int8_t connectedCountDown = 3;
 int measureServoPin = -1;
 byte nPulse = 3;
 
+class LedcOutput : public ServoOutput {  // the servos on the ESP32 pins. see servoOutput.h
+ public:
+  void attach(uint8_t s) {
+    servo[s].attach(PWM_pin[s], modelObj[s]);
+  }
+  bool attached(uint8_t s) {
+    return servo[s].attached();
+  }
+  uint32_t gain(uint8_t s) {  // Servo::usToTicks()
+    return uint32_t(65536.0 * (1 << DEFAULT_TIMER_WIDTH) * modelObj[s]->getFrequency() / (REFRESH_USEC * 50.0) + 0.5);
+  }
+  void stage(uint8_t s, int ticks) {  // a LEDC channel is written right away
+    servo[s].writeTicks(ticks);
+  }
+  bool commit() {
+    return true;
+  }
+};
+
+#ifdef PCA9685_SERVO
+Adafruit_PWMServoDriver pcaDriver(PCA9685_I2C_ADDRESS, Wire);
+PCA9685Output<TwoWire, I2cLock> pcaOutput(Wire, PCA9685_I2C_ADDRESS, &i2cLock);
+ServoOutput* servoOut = &pcaOutput;
+#else
+LedcOutput ledcOutput;
+ServoOutput* servoOut = &ledcOutput;
+#endif
+
+void servoFlush() {  // commit() for the commands that shouldn't be dropped, such as shutting the servos
+  for (byte t = 0; t < 10 && !servoOut->commit(); t++) delay(1);
+}
+
+ServoTicks servoTicks[PWM_NUM];  // the duty table of each servo (see dutyTable.h)
+
+void servoTicksSetup(byte s, const uint16_t* duty) {
+  servoTicks[s].range = modelObj[s]->getAngleRange();
+  servoTicks[s].duty = duty;
+  servoTicks[s].gain = servoOut->gain(s);
+}
+
+inline int usToTicks(byte s, int us) {
+  return (uint32_t(us) * servoTicks[s].gain) >> 16;
+}
+
+inline int halfDegreeToTicks(byte s, int half) {
+  return tableTicks(servoTicks[s], half);
+}
+
+inline int degreeToTicks(byte s, int degree) {
+  return halfDegreeToTicks(s, 2 * degree);
+}
+
 void attachAllESPServos() {
   PTLF("Calibrated Zero Position");
   for (int c = 0; c < PWM_NUM; c++) {
     byte s = c;  // attachOrder[c];
     int joint;
     joint = (s > 3) ? s + 4 : s;
+    const uint16_t* duty = dutyP1L::tick;
     switch (servoModelList[joint]) {
-      case G41: modelObj[s] = &servoG41; break;
-      case P1S: modelObj[s] = &servoP1S; break;
-      case P1L: modelObj[s] = &servoP1L; break;
-      case P2K: modelObj[s] = &servoP1L; break;
-      case P50: modelObj[s] = &servoP50; break;
+      case G41: modelObj[s] = &servoG41; duty = dutyG41::tick; break;
+      case P1S: modelObj[s] = &servoP1S; duty = dutyP1S::tick; break;
+      case P1L: modelObj[s] = &servoP1L; duty = dutyP1L::tick; break;
+      case P2K: modelObj[s] = &servoP1L; duty = dutyP1L::tick; break;
+      case P50: modelObj[s] = &servoP50; duty = dutyP50::tick; break;
     }
-    servo[s].attach(PWM_pin[s], modelObj[s]);
+    servoOut->attach(s);
+    servoTicksSetup(s, duty);
     zeroPosition[joint] = modelObj[s]->getAngleRange() / 2 + float(middleShift[joint]) * rotationDirection[joint];
     calibratedZeroPosition[joint] = zeroPosition[joint] + float(servoCalib[joint]) * rotationDirection[joint];
     PT(calibratedZeroPosition[joint]);
@@ -51,9 +117,9 @@ void attachAllESPServos() {
 }
 void reAttachAllServos() {
   for (int c = 0; c < PWM_NUM; c++)
-    if (!servo[c].attached()) {
+    if (!servoOut->attached(c)) {
       byte s = c < 4 ? c : c + 4;
-      if (!movedJoint[s]) { servo[c].attach(PWM_pin[c], modelObj[c]); }
+      if (!movedJoint[s]) { servoOut->attach(c); }
     }
   delay(12);
 }
@@ -86,6 +152,15 @@ void servoSetup() {
   ** ledc: 14 => Group: 1, Channel: 6, Timer: 3
   ** ledc: 15 => Group: 1, Channel: 7, Timer: 3
   */
+#ifdef PCA9685_SERVO
+  PTL("Setup PCA9685 servo driver...");
+  pcaDriver.begin();
+  pcaDriver.setOscillatorFrequency(PCA9685_OSCILLATOR);
+  pcaDriver.setPWMFreq(SERVO_FREQ);  // the prescale rounds it to the closest the board can make
+  pcaOutput.setPrescale(PCA9685_OSCILLATOR, pcaDriver.readPrescale());
+  if (pcaDriver.readPrescale() != pca9685Prescale(SERVO_FREQ))
+    PTLF("The PCA9685 prescale doesn't match the duty tables");
+#endif
   attachAllESPServos();
 }
 
@@ -98,19 +173,20 @@ void shutServos(byte id = PWM_NUM) {
        zero. It will cause the servo to jump before shutdown.
     */
       //    if (shutEsp32Servo)
-      servo[s].writeMicroseconds(
-          0);  // the joints may randomly jump when the signal goes to zero. the source is in hardware
-               //     servo[s].detach(); //another way to turn off the servo
+      servoOut->stage(s, 0);  // the joints may randomly jump when the signal goes to zero. the source is in hardware
+                              //     servo[s].detach(); //another way to turn off the servo
     }
   } else {
     id = (PWM_NUM == 12 && id > 3) ? id - 4 : id;
-    servo[id].writeMicroseconds(0);
+    servoOut->stage(id, 0);
   }
+  servoFlush();
   //  shutEsp32Servo = false;
 }
 
 void setServoP(unsigned int p) {
-  for (byte s = 0; s < PWM_NUM; s++) servo[s].writeMicroseconds(p);
+  for (byte s = 0; s < PWM_NUM; s++) servoOut->stage(s, usToTicks(s, p));
+  servoFlush();
 }
 
 int measurePulseWidth(uint8_t pwmReadPin) {
@@ -127,6 +203,9 @@ int measurePulseWidth(uint8_t pwmReadPin) {
 
 float readFeedback(byte s)  // returns the pulse width in microseconds
 {                           // s is not the joint index, but the pwm pin index that may shift by 4
+#ifdef PCA9685_SERVO
+  return -1;  // the feedback line of a servo on the board isn't wired to the ESP32
+#endif
   // if(!servo[s].attached())// adding this condition will cause servos to jig. why?
   servo[s].attach(
       PWM_pin[s],
@@ -154,17 +233,62 @@ float readFeedback(byte s)  // returns the pulse width in microseconds
     return -4;
 }
 
+PulseCapture pulseCapture[PWM_NUM];
+
+void IRAM_ATTR feedbackEdge(void* arg) {
+  PulseCapture* c = (PulseCapture*)arg;
+  c->edge(gpio_get_level(gpio_num_t(c->pin)), uint32_t(esp_timer_get_time()));
+}
+
+// read the feedback of the servos s with wantQ[s] in one wait (see feedbackCapture.h). width[s] is the pulse width in
+// microseconds, or -1 if the servo didn't answer
+void captureFeedback(const bool* wantQ, int* width) {
+#ifdef PCA9685_SERVO
+  for (byte s = 0; s < PWM_NUM; s++) width[s] = -1;  // see readFeedback()
+  return;
+#endif
+  for (byte s = 0; s < PWM_NUM; s++)
+    if (wantQ[s]) servo[s].attach(PWM_pin[s], modelObj[s]);
+  delay(3);  // it takes time to attach
+  for (byte s = 0; s < PWM_NUM; s++)
+    if (wantQ[s]) {  // the same request as readFeedback(). the servos answered already are captured meanwhile
+      pulseCapture[s].begin(PWM_pin[s], nPulse, maxPulseWidth);
+      servo[s].writeMicroseconds(feedbackSignal);
+      servo[s].detach();
+      pinMode(PWM_pin[s], INPUT);
+      attachInterruptArg(PWM_pin[s], feedbackEdge, pulseCapture + s, CHANGE);
+    }
+  long start = micros();
+  long timeout = long(nPulse) * (waitTimeForResponse + maxPulseWidth);  // what readFeedback() waits for one servo
+  for (bool doneQ = false; !doneQ && micros() - start < timeout;) {
+    doneQ = true;
+    for (byte s = 0; s < PWM_NUM; s++)
+      if (wantQ[s] && !pulseCapture[s].doneQ()) doneQ = false;
+  }
+  for (byte s = 0; s < PWM_NUM; s++)
+    if (wantQ[s]) {
+      detachInterrupt(PWM_pin[s]);
+      width[s] = pulseCapture[s].width();
+    }
+}
+
 void servoFeedback(int8_t index = 16) {
   int readAngles[16];
   byte begin = 0, end = 15;
   if (index > -1 && index < 16) begin = end = index;  //
   bool infoPrinted = false;
+  int width[PWM_NUM];
+  if (begin != end) {  // all the servos answer in the same wait
+    bool wantQ[PWM_NUM];
+    for (byte s = 0; s < PWM_NUM; s++) wantQ[s] = connectedFeedbackServo[s < 4 ? s : s + 4] > -connectedCountDown;
+    captureFeedback(wantQ, width);
+  }
   for (byte jointIdx = begin; jointIdx <= end; jointIdx++) {
     if (jointIdx == 4)                                             // skip the shoulder roll joints
       jointIdx += 4;
     if (connectedFeedbackServo[jointIdx] > -connectedCountDown) {  // skip unconnected servo to save time
       byte i = jointIdx < 4 ? jointIdx : jointIdx - 4;
-      int feedback = readFeedback(i);
+      int feedback = begin != end ? width[i] : readFeedback(i);
       if (feedback > -1) {
         connectedFeedbackServo[jointIdx] =
             min(int8_t(connectedFeedbackServo[jointIdx] + 1), int8_t(connectedCountDown));
@@ -220,36 +344,17 @@ bool servoFollow() {
   return moved;
 }
 
-void readAllFeedbackFast()  // returns the pulse width in microseconds
-{                           // s is not the joint index, but the pwm pin index that may shift by 4
-  // if(!servo[s].attached())// adding this condition will cause servos to jig. why?
-  for (int s = 0; s < 12; s++)
-    servo[s].attach(PWM_pin[s], modelObj[s]);  // sometimes servo[s].attach() is true, but it still needs to be
-                                               // attached. why there's no conflict?
-  delay(3);  // it takes time to attach. potentially it can be avoided using the attached() check. but it doesn't work
-             // for now.
-
+void readAllFeedbackFast() {  // a snapshot of the joints 0 ~ 2 and 8 ~ 15 for the teach mode
+  bool wantQ[PWM_NUM];
+  int width[PWM_NUM];
+  for (byte s = 0; s < PWM_NUM; s++) wantQ[s] = s != 3;  // s is the pwm pin index. joint 3 isn't recorded
+  captureFeedback(wantQ, width);
   for (int jointIdx = 0; jointIdx < DOF; jointIdx++) {
     if (jointIdx == 3) jointIdx = 8;
     int s = jointIdx < 4 ? jointIdx : jointIdx - 4;
-    servo[s].writeMicroseconds(feedbackSignal);
-    servo[s].detach();
-    pinMode(PWM_pin[s], INPUT);
-    float mean = 0;
-    int n = nPulse;
-    for (byte i = 0; i < nPulse; i++) {  // measure three times to calculate the mean
-      int temp = measurePulseWidth(PWM_pin[s]);
-      if (temp < 400) {  // there can be noises to return a fake pulsewidth. it's usually smaller than the shortest
-                         // possible signal (500ms)
-        n--;
-      } else if (i > 0)  // skip the first pulse
-        mean += temp;
-    }
-    if (n > 1) {
-      // PTT(n, ": ")
-      int feedback = mean / (n - 1);
+    if (width[s] > 0) {
       float convertedAngle =
-          (servo[s].pulseToAngle(feedback) - calibratedZeroPosition[jointIdx]) / rotationDirection[jointIdx];
+          (servo[s].pulseToAngle(width[s]) - calibratedZeroPosition[jointIdx]) / rotationDirection[jointIdx];
       currentAng[jointIdx] = round(convertedAngle);
       // PTT(currentAng[jointIdx], '\t');
     }
@@ -0,0 +1,64 @@
+/* Interrupt-driven capture of the servo feedback pulses.
+
+   A feedback servo answers the request pulse (feedbackSignal) with a few pulses whose width is its position. Polling
+   them with digitalRead() takes one servo at a time, so a snapshot of the whole body was the sum of all the waits.
+   captureFeedback() in espServo.h sends the request to every servo, then lets the edge interrupts of all the pins
+   fill one PulseCapture each, so the answers of all the servos arrive in the same wait.
+
+   PulseCapture::edge() gets the level after an edge and the time in us. Like readFeedback(), it counts wanted
+   pulses, skips the first one and the ones outside CAPTURE_MIN_US ~ maxWidth (noise), and averages the rest.
+   There is no Arduino dependency, so a host build can feed it a mock pulse train.
+*/
+#ifndef FEEDBACK_CAPTURE_H
+#define FEEDBACK_CAPTURE_H
+
+#include <stdint.h>
+
+#define CAPTURE_MIN_US 400  // shorter than the shortest position pulse (500 us). it's noise
+
+class PulseCapture {
+ public:
+  uint8_t pin;
+  uint16_t maxWidth;  // us
+  uint8_t wanted;     // pulses to count, including the first one
+  volatile uint32_t riseUs;
+  volatile uint32_t sum;
+  volatile uint8_t pulses;  // counted so far
+  volatile uint8_t valid;   // the pulses in sum
+  volatile bool highQ;
+
+  void begin(uint8_t p, uint8_t n, uint16_t maxUs) {
+    pin = p;
+    wanted = n;
+    maxWidth = maxUs;
+    sum = 0;
+    pulses = valid = 0;
+    highQ = false;
+  }
+
+  inline void edge(bool level, uint32_t nowUs) {  // called by the interrupt of the pin
+    if (pulses >= wanted) return;
+    if (level) {
+      riseUs = nowUs;
+      highQ = true;
+      return;
+    }
+    if (!highQ) return;  // the capture started in the middle of a pulse
+    highQ = false;
+    uint32_t width = nowUs - riseUs;
+    if (pulses++ > 0 && width >= CAPTURE_MIN_US && width <= maxWidth) {
+      sum += width;
+      valid++;
+    }
+  }
+
+  bool doneQ() {
+    return pulses >= wanted;
+  }
+
+  int width() {  // the mean pulse width in us, -1 without a valid pulse
+    return valid ? int(sum / valid) : -1;
+  }
+};
+
+#endif
@@ -0,0 +1,140 @@
+/* Gait synthesizer.
+
+   Builds the data of a gait, in the same layout as the instinct gaits (a 4 byte header, then period frames of the
+   WALKING_DOF joints 8 ~ 15), from a few parameters instead of a table generated offline:
+     stride  mm the foot travels in the stance. negative walks the other way
+     height  mm the foot lifts in the swing
+     duty    % of the cycle in the stance
+     frames  the period of the gait, up to GAIT_SYNTH_MAX_FRAMES. the playback interpolates between frames
+     phase   % of the cycle by which each leg leads, for legs 0 ~ 3
+     x, z    mm, the middle of the stance from the shoulder. 0 and GAIT_SYNTH_Z if they are not given
+   In the stance the foot moves in a straight line at a constant speed. In the swing it follows a cubic Bezier curve
+   that lifts it by height. legIK() of kinematics.h turns the feet into joint angles within the limits.
+
+   The synthesized gaits are kept in a small cache, looked up by the hash of their parameters, and the least recently
+   used one is dropped for a new one. So switching back to a recent gait costs a lookup.
+
+   Like kinematics.h, there is no Arduino dependency.
+*/
+#ifndef GAIT_SYNTH_H
+#define GAIT_SYNTH_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define GAIT_SYNTH_PARS 10
+#define GAIT_SYNTH_MIN_PARS 8  // x and z are optional
+#define GAIT_SYNTH_MAX_FRAMES 64
+#define GAIT_SYNTH_Z 70
+#define GAIT_SYNTH_HEADER 4
+#define GAIT_SYNTH_LEN (GAIT_SYNTH_HEADER + GAIT_SYNTH_MAX_FRAMES * 8)
+#define GAIT_CACHE_SIZE 4
+
+struct GaitPar {  // the order of the binary command
+  int8_t stride;
+  int8_t height;
+  int8_t duty;
+  int8_t frames;
+  int8_t phase[4];
+  int8_t x;
+  int8_t z;
+};
+
+void footPath(const GaitPar& p, float t, float& x, float& z) {  // t: 0 ~ 1 of the cycle, from the start of the stance
+  float duty = (p.duty < 5 ? 5 : (p.duty > 95 ? 95 : p.duty)) / 100.0f;
+  float half = p.stride / 2.0f;
+  if (t < duty) {
+    x = p.x + half - p.stride * t / duty;
+    z = p.z;
+  } else {  // control points (-half, z - 4h/3), (half, z - 4h/3) lift the middle of the curve by h
+    float s = (t - duty) / (1 - duty);
+    x = p.x + half * (2 * s * s * (3 - 2 * s) - 1);
+    z = p.z - 4 * p.height * s * (1 - s);  // 3 (1 - s)^2 s + 3 (1 - s) s^2 = 3 s (1 - s)
+  }
+}
+
+// data: GAIT_SYNTH_HEADER + frames * 8 bytes. limit: the angle limits of joints 8 ~ 15
+bool synthesizeGait(const GaitPar& p, int8_t* data, const int (*limit)[2]) {
+  if (p.frames < 2 || p.frames > GAIT_SYNTH_MAX_FRAMES) return false;
+  for (int8_t ratio = 1; ratio <= 2; ratio++) {  // angles beyond int8_t are stored halved, like the instinct skills
+    data[0] = p.frames;
+    data[1] = data[2] = 0;  // expected roll and pitch
+    data[3] = ratio;
+    bool fitQ = true;
+    for (int k = 0; k < p.frames; k++) {
+      int8_t* frame = data + GAIT_SYNTH_HEADER + k * 8;
+      for (uint8_t leg = 0; leg < 4; leg++) {
+        float t = float(k) / p.frames + p.phase[leg] / 100.0f;
+        t -= int(t);
+        if (t < 0) t += 1;
+        float x, z, shoulder, knee;
+        footPath(p, t, x, z);
+        legIK(x, z, shoulder, knee, limit[leg], limit[4 + leg]);
+        int a[2] = {int(lroundf(shoulder / ratio)), int(lroundf(knee / ratio))};
+        for (uint8_t j = 0; j < 2; j++) {
+          if (a[j] > 125 || a[j] < -125) {  // 126 is '~'
+            fitQ = false;
+            a[j] = a[j] > 0 ? 125 : -125;
+          }
+          frame[leg + 4 * j] = a[j];
+        }
+      }
+    }
+    if (fitQ) return true;
+  }
+  return true;  // the few angles beyond +-250 were clipped
+}
+
+class GaitCache {
+  struct Entry {
+    uint32_t hash;
+    uint32_t lastUse;  // 0 for an empty entry
+    GaitPar par;
+    int8_t data[GAIT_SYNTH_LEN];
+  };
+  Entry entry[GAIT_CACHE_SIZE];
+  uint32_t clock;
+
+  static uint32_t hashPar(const GaitPar& p) {  // FNV-1a
+    const uint8_t* b = (const uint8_t*)&p;
+    uint32_t h = 2166136261u;
+    for (uint8_t i = 0; i < sizeof(GaitPar); i++) h = (h ^ b[i]) * 16777619u;
+    return h;
+  }
+
+ public:
+  uint16_t hits, misses;
+
+  GaitCache() {
+    memset(entry, 0, sizeof(entry));
+    clock = 0;
+    hits = misses = 0;
+  }
+
+  // par: GAIT_SYNTH_MIN_PARS ~ GAIT_SYNTH_PARS bytes of the command. NULL if the parameters can't make a gait
+  const int8_t* get(const int8_t* par, uint8_t len, const int (*limit)[2]) {
+    GaitPar p;
+    p.x = 0;
+    p.z = GAIT_SYNTH_Z;
+    memcpy(&p, par, len < GAIT_SYNTH_PARS ? len : GAIT_SYNTH_PARS);
+    uint32_t h = hashPar(p);
+    Entry* e = entry;
+    for (uint8_t i = 0; i < GAIT_CACHE_SIZE; i++) {
+      if (entry[i].lastUse && entry[i].hash == h && !memcmp(&entry[i].par, &p, sizeof(GaitPar))) {
+        entry[i].lastUse = ++clock;
+        hits++;
+        return entry[i].data;
+      }
+      if (entry[i].lastUse < e->lastUse) e = entry + i;
+    }
+    if (!synthesizeGait(p, e->data, limit)) return NULL;
+    misses++;
+    e->hash = h;
+    e->par = p;
+    e->lastUse = ++clock;
+    return e->data;
+  }
+};
+
+#endif
@@ -2,9 +2,33 @@
 #include "mpu6050/src/I2Cdev.h"
 #include "mpu6050/src/MPU6050_6Axis_MotionApps_V6_12.h"
 
+// Wire is shared by the IMU and the PCA9685 servo board (servoOutput.h), which are driven by the tasks of both cores.
+// the check and the set of the flag are one critical section, so only one of them gets the bus
+class I2cLock {
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+  volatile bool busyQ = false;
+
+ public:
+  bool tryLock() {  // doesn't wait
+    portENTER_CRITICAL(&mux);
+    bool freeQ = !busyQ;
+    busyQ = true;
+    portEXIT_CRITICAL(&mux);
+    return freeQ;
+  }
+  void lock() {
+    while (!tryLock()) delay(1);
+  }
+  void unlock() {
+    busyQ = false;
+  }
+};
+I2cLock i2cLock;
+
 bool calibrateQ = false;
 float ypr[3];
 float previous_ypr[3];
+float rollPitchRate[2];  // degrees/s. the derivative of ypr[2] and ypr[1], for the PD balance (see balancePD.h)
 
 // Turning control variables
 bool turningQ = false;        // Turning control switch
@@ -193,7 +217,7 @@ class mpu6050p : public MPU6050 {
     PTL("MPU6050 calibration started");
 
     // wait for other I2C devices to be idle
-    while (imuLockI2c) delay(1);
+    i2cLock.lock();
 
     PTLF("Calibrate MPU6050...");
     CalibrateAccel(20);
@@ -205,6 +229,7 @@ class mpu6050p : public MPU6050 {
     config.putShort("mpu3", getXGyroOffset());
     config.putShort("mpu4", getYGyroOffset());
     config.putShort("mpu5", getZGyroOffset());
+    i2cLock.unlock();
 
     PrintActiveOffsets();
   }
@@ -420,7 +445,7 @@ void calibrateICM() {
   PTL("ICM42670 calibration started");
 
   // wait for other I2C devices to be idle
-  while (imuLockI2c) delay(1);
+  i2cLock.lock();
 
   PTLF("Calibrate ICM42670...");
   for (byte i = 0; i < 3; i++) {
@@ -428,6 +453,7 @@ void calibrateICM() {
     icm.offset_gyro[i] = 0;
   }
   icm.getOffset(200);
+  i2cLock.unlock();
   if (icm.offset_gyro[0] == -32768 || icm.offset_gyro[1] == -32768 || icm.offset_gyro[2] == -32768) {
     PT("Reading error: ");
     PT(icm.offset_gyro[0]);
@@ -494,6 +520,7 @@ void icm42670Setup(bool calibrateQ = true) {
 
 #define PRINT_ACCELERATION 1
 void print6Axis() {
+  PROFILE(PROF_PRINT_6_AXIS);
   if (!updateGyroQ) return;
   char buffer[50];  // Adjust buffer size as needed
 
@@ -540,11 +567,11 @@ bool readIMU() {
 
     // If updateGyroQ became false during waiting, exit early
     if (!updateGyroQ) { return false; }
-    imuLockI2c = true;
+    if (!i2cLock.tryLock()) return false;  // the servo board is sending a frame. read the IMU on the next tick
 
     // Final check before IMU operations - exit if requested
     if (!updateGyroQ) {
-      imuLockI2c = false;  // Release lock before exiting
+      i2cLock.unlock();  // Release lock before exiting
       return false;
     }
 
@@ -560,26 +587,37 @@ bool readIMU() {
       }
       // Negate yaw to match polar coordinate convention (positive = counterclockwise)
       ypr[0] = -ypr[0];
+      // the Madgwick filter's roll turns with gx and its pitch turns against gy
+      rollPitchRate[0] = icm.gx_real;
+      rollPitchRate[1] = -icm.gy_real;
     }
 
     // if programming failed, don't try to do anything
     // read a packet from FIFO
     if (mpuQ) {
-      updated |= mpu.read_mpu6050();  // mpu6050's frequency is lower than icm42670
+      static unsigned long lastSample = 0;
+      float lastRollPitch[2] = {ypr[2], ypr[1]};
+      bool sampleQ = mpu.read_mpu6050();  // mpu6050's frequency is lower than icm42670
+      updated |= sampleQ;
       for (byte i = 0; i < 3; i++) {
         xyzReal[i] = mpu.a_real[i];
         ypr[i] = mpu.ypr[i];
       }
       // Negate yaw to match polar coordinate convention (positive = counterclockwise)
       ypr[0] = -ypr[0];
+      if (sampleQ && !icmQ) {  // the DMP packet has no calibrated rates. differentiate the angles instead
+        unsigned long now = micros();
+        float dt = (now - lastSample) / 1000000.0;
+        if (dt > 0 && dt < 0.1)
+          for (byte i = 0; i < 2; i++) rollPitchRate[i] = (ypr[2 - i] - lastRollPitch[i]) / dt;
+        lastSample = now;
+      }
     }
 
-    imuLockI2c = false;
+    i2cLock.unlock();
     return updated;
-  } else {
-    vTaskDelay(1 / portTICK_PERIOD_MS);  // Use FreeRTOS delay function instead of delay()
-    return false;
-  }
+  } else
+    return false;  // don't block here. the caller owns the timing (taskIMU or the control task)
 }
 
 // Wait for IMU readings to converge before evaluating exceptions
@@ -828,6 +866,7 @@ void imuSetup() {
   // ensure updateGyroQ is true
   updateGyroQ = true;
 
+#ifndef CONTROL_LOOP  // otherwise the control task samples the IMU at CONTROL_FREQ (controlLoop.h)
   // Create IMU task
   xTaskCreatePinnedToCore(taskIMU,       // task function
                           "TaskIMU",     // task name
@@ -849,6 +888,7 @@ void imuSetup() {
       PTLF("IMU task created successfully");
     }
   }
+#endif
 
   // imuException = xyzReal[3] < 0;
 }
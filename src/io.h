@@ -10,6 +10,7 @@
 
 template <typename T>
 void printToAllPorts(T text, bool newLine = true) {
+  PROFILE(PROF_PRINT_TO_ALL_PORTS);
   String textResponse = String(text);
   if (newLine) { textResponse += "\r\n"; }
 #ifdef BT_BLE
@@ -0,0 +1,50 @@
+/* The ASCII joint commands.
+
+   i, m, c, t, u and b take a list of numbers read in pairs, so several commands can be combined in one: "m8 40 m8 -35
+   m 0 50" can be written as "m8 40 8 -35 0 50". The list is copied to cmdForParsing first, since loadBySkillName() may
+   overwrite newCmd while the pairs run, and split in place by strtok(), so parsing a command allocates nothing.
+   reaction() runs each pair. Nothing here touches the hardware, so the host test of the allocations parses its
+   commands here too.
+*/
+#ifndef JOINT_COMMAND_H
+#define JOINT_COMMAND_H
+
+#include <stdlib.h>
+#include <string.h>
+
+char cmdForParsing[BUFF_LEN + 1];  // a copy of an ASCII joint command. loadBySkillName() may overwrite newCmd
+
+void copyJointCmd(const char* cmd, int len) {
+  strncpy(cmdForParsing, cmd, len);
+  cmdForParsing[len] = '\0';
+}
+
+char* firstJointPair() {  // the first number of the copied command, NULL if it's empty
+  return strtok(cmdForParsing, " ,");
+}
+
+// reads the pair at pch into target and moves pch to the next one. returns how many numbers were read. a missing
+// number leaves its target alone
+int readJointPair(char*& pch, int* target) {
+  int inLen = 0;
+  for (byte b = 0; b < 2 && pch != NULL; b++) {
+    target[b] = atoi(pch);  //@@@ cast
+    pch = strtok(NULL, " ,\t");
+    inLen++;
+  }
+  return inLen;
+}
+
+// puts the angle target[1] of joint target[0] of an i or m command into targetFrame. a head joint is also held in
+// targetHead, so the skills keep it while the head is controlled manually
+void setJointTarget(int* targetFrame, const int* target) {
+  if (target[0] < 0 || target[0] >= DOF) return;
+  targetFrame[target[0]] = target[1];
+  if (target[0] < 4) {
+    targetHead[target[0]] = target[1];
+    manualHeadQ = true;
+  } else
+    nonHeadJointQ = true;
+}
+
+#endif
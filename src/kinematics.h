@@ -0,0 +1,75 @@
+/* Kinematics of a leg: the shoulder (joint 8 ~ 11) and the knee (joint 12 ~ 15) of the same leg.
+
+   The leg is two links in the sagittal plane of the shoulder. x points the way the foot swings when the shoulder
+   angle grows, z points down, both in mm from the shoulder axis. With the shoulder angle a and the knee angle k in
+   degrees, the way the joints are commanded:
+     thigh  LEG_UPPER * (sin(a), cos(a))      a = 0 is straight down
+     shin   LEG_LOWER * (sin(b), cos(b))      b = a + k - 90, so k = 0 is the L shape of the calibration posture
+     foot = thigh + shin
+   legFK() reads the sine table of waveTable.h. legIK() is closed form: the law of cosines gives the knee, and the
+   direction of the foot gives the shoulder. It takes the knee that bends the way the standing postures do
+   (-90 < k < 90), and clamps both joints to the limits passed in, usually angleLimit.
+
+   Like balancePD.h, there is no Arduino dependency, so a host build can check and time it.
+*/
+#ifndef KINEMATICS_H
+#define KINEMATICS_H
+
+#include <math.h>
+
+#define LEG_UPPER 46.0f  // mm, shoulder axis to knee axis
+#define LEG_LOWER 46.0f  // mm, knee axis to the foot
+#define DEG_PER_RAD 57.29578f
+
+inline float tableSin(float degree) {  // within 2e-4 of sin()
+  return waveSine(uint16_t(int32_t(degree * (65536.0f / 360.0f)))) / float(WAVE_ONE);
+}
+
+inline float tableCos(float degree) {
+  return tableSin(degree + 90);
+}
+
+inline float fastAtan2(float y, float x) {  // in degrees, within 1e-3 degree
+  float ax = fabsf(x), ay = fabsf(y);
+  if (ax == 0 && ay == 0) return 0;
+  bool swapQ = ay > ax;
+  float t = swapQ ? ax / ay : ay / ax;  // 0 ~ 1
+  float t2 = t * t;
+  float p = -0.11643287f + t2 * (0.05265332f - t2 * 0.01172120f);
+  float r = t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f + t2 * p)));
+  if (swapQ) r = float(M_PI_2) - r;
+  if (x < 0) r = float(M_PI) - r;
+  return (y < 0 ? -r : r) * DEG_PER_RAD;
+}
+
+void legFK(float shoulder, float knee, float& x, float& z) {
+  float b = shoulder + knee - 90;
+  x = LEG_UPPER * tableSin(shoulder) + LEG_LOWER * tableSin(b);
+  z = LEG_UPPER * tableCos(shoulder) + LEG_LOWER * tableCos(b);
+}
+
+// false if the foot is out of reach or a joint had to be clamped. the angles are still the closest ones
+bool legIK(float x, float z, float& shoulder, float& knee, const int shoulderLimit[2], const int kneeLimit[2]) {
+  bool reachedQ = true;
+  // |foot|^2 = U^2 + L^2 + 2 U L cos(b - a), and cos(b - a) = sin(k)
+  float s = (x * x + z * z - LEG_UPPER * LEG_UPPER - LEG_LOWER * LEG_LOWER) / (2 * LEG_UPPER * LEG_LOWER);
+  if (s > 1 || s < -1) {
+    s = s > 1 ? 1 : -1;
+    reachedQ = false;
+  }
+  float c = sqrtf(1 - s * s);  // cos(k) > 0 picks the knee of the standing postures
+  knee = fastAtan2(s, c);
+  // the foot is at a + atan2(L sin(k - 90), U + L cos(k - 90)) = a + atan2(-L cos(k), U + L sin(k))
+  shoulder = fastAtan2(x, z) - fastAtan2(-LEG_LOWER * c, LEG_UPPER + LEG_LOWER * s);
+  if (shoulder > 180) shoulder -= 360;
+  if (shoulder < -180) shoulder += 360;
+  if (shoulder < shoulderLimit[0] || shoulder > shoulderLimit[1] || knee < kneeLimit[0] || knee > kneeLimit[1]) {
+    shoulder = shoulder < shoulderLimit[0] ? shoulderLimit[0]
+                                           : (shoulder > shoulderLimit[1] ? shoulderLimit[1] : shoulder);
+    knee = knee < kneeLimit[0] ? kneeLimit[0] : (knee > kneeLimit[1] ? kneeLimit[1] : knee);
+    reachedQ = false;
+  }
+  return reachedQ;
+}
+
+#endif
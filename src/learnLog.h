@@ -0,0 +1,122 @@
+/* Teach-mode recording log.
+
+   learnByDrag() streams each recorded frame of the LEARN_JOINTS joints (0 ~ 2 and 8 ~ 15) into a file, so a
+   demonstration is only limited by the flash, not by learnData. A frame takes a control byte, then
+     LEARN_FRAME_DELTA  signed 4-bit deltas from the previous frame, two per byte, the first one in the low nibble, if
+                        all of them fit. a slow drag moves a joint by a few degrees between two frames
+     LEARN_FRAME_RAW    the LEARN_JOINTS angles
+   the same as the delta and raw frames of skillCodec.h. The first frame is always raw.
+
+   The functions take any file type with write(const uint8_t*, size_t) and read(uint8_t*, size_t), so the robot
+   passes a LittleFS File and a host build can pass a stand-in over a plain file.
+
+   smoothMerge() drops the frames of a loaded recording that the replay can do without, so it fits in learnData.
+*/
+#ifndef LEARN_LOG_H
+#define LEARN_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LEARN_JOINTS 11
+#define LEARN_FRAME_RAW 0x00
+#define LEARN_FRAME_DELTA 0x40
+#define LEARN_FRAME_MAX_BYTES (1 + LEARN_JOINTS)
+#define LEARN_MAX_FRAME 125  // the frames smoothMerge() can take at once
+#define LEARN_TOLERANCE 4    // degrees a joint can be off its recording when the kept frames are replayed
+
+// last: the previous frame. it's updated to frame. returns the bytes written, 0 if the file is full
+template <class F>
+size_t writeLearnFrame(F& file, const int8_t* frame, int8_t* last, bool rawQ) {
+  uint8_t code[LEARN_FRAME_MAX_BYTES];
+  size_t len = 1;
+  bool deltaQ = !rawQ;
+  for (uint8_t j = 0; j < LEARN_JOINTS && deltaQ; j++) {
+    int d = frame[j] - last[j];
+    deltaQ = d >= -8 && d <= 7;
+  }
+  if (deltaQ) {
+    code[0] = LEARN_FRAME_DELTA;
+    for (uint8_t j = 0; j < LEARN_JOINTS; j += 2) {
+      uint8_t lo = (frame[j] - last[j]) & 0x0F;
+      uint8_t hi = j + 1 < LEARN_JOINTS ? (frame[j + 1] - last[j + 1]) & 0x0F : 0;
+      code[len++] = lo | hi << 4;
+    }
+  } else {
+    code[0] = LEARN_FRAME_RAW;
+    for (uint8_t j = 0; j < LEARN_JOINTS; j++) code[len++] = frame[j];
+  }
+  for (uint8_t j = 0; j < LEARN_JOINTS; j++) last[j] = frame[j];
+  return file.write(code, len) == len ? len : 0;
+}
+
+// frame: the previous frame in, the next one out. false at the end of the log
+template <class F>
+bool readLearnFrame(F& file, int8_t* frame) {
+  uint8_t code[LEARN_FRAME_MAX_BYTES];
+  if (file.read(code, 1) != 1) return false;
+  if (code[0] == LEARN_FRAME_DELTA) {
+    size_t len = (LEARN_JOINTS + 1) / 2;
+    if (file.read(code + 1, len) != len) return false;
+    for (uint8_t j = 0; j < LEARN_JOINTS; j++) {
+      uint8_t b = code[1 + j / 2];
+      frame[j] += (j % 2) ? int8_t(b) >> 4 : int8_t(b << 4) >> 4;  // sign extend the nibble
+    }
+  } else {
+    if (file.read(code + 1, LEARN_JOINTS) != LEARN_JOINTS) return false;
+    for (uint8_t j = 0; j < LEARN_JOINTS; j++) frame[j] = code[1 + j];
+  }
+  return true;
+}
+
+// the worst frame between the kept frames a and b of data, if replaying a to b misses it by more than LEARN_TOLERANCE.
+// transform() moves all the joints along the straight line from a to b, so frame i is compared with the point
+// (i - a) / (b - a) of the way. in integers: |f(i) (b - a) - f(a) (b - i) - f(b) (i - a)| <= LEARN_TOLERANCE (b - a)
+int worstLearnFrame(const int8_t* data, int a, int b) {
+  int worst = -1;
+  long worstErr = long(LEARN_TOLERANCE) * (b - a);
+  for (int i = a + 1; i < b; i++)
+    for (int j = 0; j < LEARN_JOINTS; j++) {
+      long err = labs(long(data[i * LEARN_JOINTS + j]) * (b - a) - long(data[a * LEARN_JOINTS + j]) * (b - i) -
+                      long(data[b * LEARN_JOINTS + j]) * (i - a));
+      if (err > worstErr) {
+        worstErr = err;
+        worst = i;
+      }
+    }
+  return worst;
+}
+
+// Drop frames as long as the replay stays within LEARN_TOLERANCE of every recorded frame (Ramer-Douglas-Peucker in
+// joint space, with the L-infinity error). RDP is greedy: the bound holds, but it may keep more frames than the
+// fewest that would meet it. The segments are split from left to right instead of recursively, so it only needs a bit
+// per frame, and it compacts data in place. Every split scans its segment again, so it takes O(n k) for k kept
+// frames, O(n^2) at worst.
+// data holds total frames, up to LEARN_MAX_FRAME. The frames before first were kept by an earlier call, and stay.
+// Returns the number of frames kept
+int smoothMerge(int8_t* data, int total, int first = 0) {
+  if (total - first <= 2) return total;
+  uint8_t keepFrame[(LEARN_MAX_FRAME + 7) / 8] = {};
+  keepFrame[first / 8] |= 1 << (first % 8);
+  keepFrame[(total - 1) / 8] |= 1 << ((total - 1) % 8);
+  for (int a = first; a < total - 1;) {
+    int b = a + 1;
+    while (!(keepFrame[b / 8] >> (b % 8) & 1)) b++;
+    int worst = worstLearnFrame(data, a, b);
+    if (worst < 0)
+      a = b;  // a to b is good. move on to the next segment
+    else
+      keepFrame[worst / 8] |= 1 << (worst % 8);  // split a to b at the worst frame and check a to worst again
+  }
+  int kept = first;
+  for (int i = first; i < total; i++)
+    if (keepFrame[i / 8] >> (i % 8) & 1) {
+      if (kept != i)
+        for (int j = 0; j < LEARN_JOINTS; j++) data[kept * LEARN_JOINTS + j] = data[i * LEARN_JOINTS + j];
+      kept++;
+    }
+  return kept;
+}
+
+#endif
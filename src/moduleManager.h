@@ -230,6 +230,7 @@ void read_serial() {
 }
 
 void readSignal() {
+  PROFILE(PROF_INPUT);
   moduleIndex = activeModuleIdx();
 #ifdef IR_PIN
   read_infrared();  //  newCmdIdx = 1
@@ -275,6 +276,7 @@ void read_sound() {}
 void read_GPS() {}
 
 void readEnvironment() {
+  PROFILE(PROF_READ_ENVIRONMENT);
   if (updateGyroQ)
     if (imuUpdated && printGyroQ) print6Axis();
 
@@ -11,46 +11,15 @@ void calibratedPWM(byte i, float angle, float speedRatio = 0) {
   // if default speed is 0, no interpolation will be used
   // otherwise the speed ratio is compared to 1 degree per second.
 
+  uint32_t phaseStep = easePhaseStep(steps);
   for (int s = 0; s <= steps; s++) {
-    int degree = duty + (steps == 0 ? 0 : (1 + cos(M_PI * s / steps)) / 2 * (duty0 - duty));
-    { servo[actualServoIndex].write(degree); }
+    int degree = s == steps ? duty : duty0 + (((duty - duty0) * ease(EASE_COSINE, s * phaseStep)) >> 15);
+    servoOut->stage(actualServoIndex, degreeToTicks(actualServoIndex, degree));
+    servoFlush();
     //    delayMicroseconds(1);
   }
 }
 
-void allCalibratedPWM(int* dutyAng, byte offset = 0) {
-  for (int8_t i = DOF - 1; i >= offset; i--) { calibratedPWM(i, dutyAng[i]); }
-}
-
-template <typename T>
-void transform(T* target, byte angleDataRatio = 1, float speedRatio = 1, byte offset = 0, int period = 0,
-               int runDelay = 8) {
-  int *diff = new int[DOF - offset], maxDiff = 0;
-  for (byte i = offset; i < DOF; i++) {
-    if (manualHeadQ && i < HEAD_GROUP_LEN && token == T_SKILL)  // the head motion will be handled by skill.perform()
-      continue;
-    diff[i - offset] = currentAng[i] - target[i - offset] * angleDataRatio;
-    maxDiff = max(maxDiff, abs(diff[i - offset]));
-  }
-  int steps =
-      speedRatio > 0 ? int(round(maxDiff / 1.0 /*degreeStep*/ / speedRatio)) : 0;  // default speed is 1 degree per step
-  // if (maxDiff == 0) {
-  //   delete[] diff;
-  //   return;
-  // }
-  for (int s = 0; s <= steps; s++) {
-    if (updateGyroQ && printGyroQ) { print6Axis(); }
-
-    for (byte i = offset; i < DOF; i++) {
-      float dutyAng =
-          (target[i - offset] * angleDataRatio + (steps == 0 ? 0 : (1 + cos(M_PI * s / steps)) / 2 * diff[i - offset]));
-      calibratedPWM(i, dutyAng);
-    }
-    delay((DOF - offset) / 2);
-  }
-  delete[] diff;
-}
-
 // balancing parameters
 #define ROLL_LEVEL_TOLERANCE 5                      // the body is still considered as level, no angle adjustment
 #define PITCH_LEVEL_TOLERANCE 3
@@ -61,7 +30,7 @@ float levelTolerance[2] = {ROLL_LEVEL_TOLERANCE,
 #define LARGE_ROLL 90
 #define LARGE_PITCH 75
 
-// the following coefficients will be divided by radPerDeg in the adjust() function. so (float) 0.1 can be saved as
+// the following coefficients will be divided by radPerDeg in balanceGainSetup(). so (float) 0.1 can be saved as
 // (int8_t) 1 this trick allows using int8_t array insead of float array, saving 96 bytes and allows storage on EEPROM
 #define panF 60
 #define tiltF 60
@@ -93,31 +62,86 @@ float adaptiveParameterArray[][NUM_ADAPT_PARAM] = {{-panF / 2, 0},
                                                    {lRF, 0.5 * lPF},
                                                    {lRF, 0.5 * lPF}};
 
-float adjust(byte i, bool postureQ = false) {
-  float rollAdj, pitchAdj;
+BalanceGain balanceGain;  // the gain matrix of the joints (balanceGain.h)
+
+void balanceGainSetup() {  // must run again after balanceSlope changes
+  balanceGain.setup(adaptiveParameterArray, balanceSlope, LEFT_RIGHT_FACTOR, POSTURE_WALKING_FACTOR);
+  for (byte a = 0; a < 2; a++)
+    balanceAxis[a].setGains(balancePD[a][0] / 100.0, balancePD[a][1] / 1000.0, balancePD[a][2] / 100.0);
+}
+
+#define BALANCE_P 0          // the correction is proportional to the deviation. the default
+#define BALANCE_PD 1         // the deviation goes through the PD controller in balancePD.h first
+#define BALANCE_PD_DAMPER 15  // the derivative term damps the motion, so the slew limit can be looser
+byte balanceMode = BALANCE_P;
+// kp (1/100), kd (ms) and ki (1/100 per s) of roll and pitch. tuned on a spring-mass model of the body with the servo
+// lag and the delay of the ypr filter
+int16_t balancePD[2][3] = {{100, 30, 200}, {100, 30, 200}};
+BalanceAxis balanceAxis[2];
+
+void balanceSetup() {  // load the saved controller and build the gains
+  if (config.isKey("balanceMode")) balanceMode = config.getChar("balanceMode");
+  if (config.isKey("balancePD")) config.getBytes("balancePD", balancePD, sizeof(balancePD));
+  balanceGainSetup();
+}
+
+void printBalance() {
+  char message[80];
+  sprintf(message, "balance %s roll %d %d %d pitch %d %d %d", balanceMode == BALANCE_PD ? "PD" : "P", balancePD[0][0],
+          balancePD[0][1], balancePD[0][2], balancePD[1][0], balancePD[1][1], balancePD[1][2]);
+  printToAllPorts(message);
+}
+
+// "lm mode" selects the controller (0: P, 1: PD). "lg kpR kdR kiR kpP kdP kiP" sets the PD gains. both are saved
+void balanceCommand(const char* cmd) {
+  char sub = cmd[0];
+  char* pos = (char*)cmd + 1;
+  if (sub == 'm') {
+    balanceMode = atoi(pos) ? BALANCE_PD : BALANCE_P;
+    config.putChar("balanceMode", balanceMode);
+  } else if (sub == 'g') {
+    for (byte i = 0; i < 6; i++) {
+      char* end;
+      long v = strtol(pos, &end, 10);
+      if (end == pos) break;
+      balancePD[i / 3][i % 3] = max(0L, min(10000L, v));
+      pos = end;
+    }
+    config.putBytes("balancePD", balancePD, sizeof(balancePD));
+  }
+  balanceGainSetup();
+  printBalance();
+}
+
+// compute the adjustment of joints first ~ DOF - 1 for the latest roll and pitch deviation in one pass, then publish it
+// as the new currentAdjust. the readers never see a half updated vector
+void updateAdjust(bool postureQ, byte first = DOF - WALKING_DOF) {
   float cutOff = postureQ ? 45 : 15;  // reduce angle deviation for non-posture skills to filter noise
-  pitchAdj = adaptiveParameterArray[i][1] * max(float(-cutOff), min(float(cutOff), RollPitchDeviation[1]));
-  if (i == 1 || i > 3) {              // check idx = 1
-    bool leftQ = (i - 1) % 4 > 1 ? true : false;
-    // bool frontQ = i % 4 < 2 ? true : false;
-    // bool upperQ = i / 4 < 3 ? true : false;
-    float leftRightFactor = 1;
-    if ((leftQ && balanceSlope[0] * RollPitchDeviation[0] > 0)  // operator * is higher than &&
-        || (!leftQ && balanceSlope[0] * RollPitchDeviation[0] < 0))
-      leftRightFactor = LEFT_RIGHT_FACTOR * abs(balanceSlope[0]);
-    rollAdj = (i == 1 || i > 7 ? fabs(RollPitchDeviation[0]) : RollPitchDeviation[0]) * adaptiveParameterArray[i][0] *
-              leftRightFactor;
-    //    rollAdj = fabs(RollPitchDeviation[0]) * adaptiveParameterArray[i][0] * leftRightFactor;
-  } else
-    rollAdj = RollPitchDeviation[0] * adaptiveParameterArray[i][0];
-  float idealAdjust =
-      radPerDeg * ((i > 3 ? POSTURE_WALKING_FACTOR : 1) * balanceSlope[0] * rollAdj - balanceSlope[1] * pitchAdj);
-
-  currentAdjust[i] += max(min(idealAdjust - currentAdjust[i], float(ADJUSTMENT_DAMPER)), -float(ADJUSTMENT_DAMPER));
-
-  int thres = (i > 3 && i % 4 < 2) ? 15 : 45;
-  currentAdjust[i] = max(float(-45), min(float(thres), currentAdjust[i]));
-  return currentAdjust[i];
+  float roll = RollPitchDeviation[0];
+  float pitch = RollPitchDeviation[1];
+  float damper = ADJUSTMENT_DAMPER;
+  if (balanceMode == BALANCE_PD) {
+    static unsigned long lastUpdate = 0;
+    unsigned long now = micros();
+    float dt = min((now - lastUpdate) / 1000000.0, 0.05);  // a long pause is not integrated
+    lastUpdate = now;
+    roll = balanceAxis[0].update(roll, rollPitchRate[0], dt, 45);
+    pitch = balanceAxis[1].update(pitch, rollPitchRate[1], dt, cutOff);
+    damper = BALANCE_PD_DAMPER;
+  }
+  MOTION_LOCK;  // clearAdjust() publishes from the loop task
+  float* next = adjustBuffer[currentAdjust == adjustBuffer[0]];
+  balanceGain.step(currentAdjust, next, roll, pitch, cutOff, damper, first);
+  currentAdjust = next;
+  MOTION_UNLOCK;
+}
+
+void clearAdjust() {  // publish a zero adjustment the same way as updateAdjust(), so it can't race with it
+  MOTION_LOCK;
+  float* next = adjustBuffer[currentAdjust == adjustBuffer[0]];
+  for (byte i = 0; i < DOF; i++) next[i] = 0;
+  currentAdjust = next;
+  MOTION_UNLOCK;
 }
 
 int calibratePincerByVibration(int start, int end, int step, int threshold = 10000 * gFactor) {
@@ -168,127 +192,14 @@ int8_t loopDelay = 5;
 int8_t skipStep[] = {1, 3};  // support, swing
 int8_t phase[] = {0, 30, 50, 80};
 
-class CPG {
- private:
-  int _nSample;
-  float* precalcCos;
-  int* pick;
-  float* sample;       // shrinked sample after skipping points
-  bool* supportStage;  // mark if each sample point is in support stage
-  int sampleLen;
-  int shiftIndex[5];
-  int edge;
-  int8_t _amplitude;
-  int8_t _sideRatio;  // left/right x 10
-  int8_t _stateSwitchAngle;
-  int8_t _loopDelay;
-  int8_t _phase[5];  // range 200. the first 100 is the support stage. The last one should always be 0.
- public:
-  int8_t _midShift[2];
-  int8_t _skipStep[2];
-  CPG(int nSample, int8_t skipStep[]) {
-    _nSample = nSample;
-    precalcCos = new float[_nSample + 1];
-    pick = new int[_nSample + 1];
-    sample = nullptr;        // will be allocated in setPar
-    supportStage = nullptr;  // will be allocated in setPar
-    _phase[4] = 0;           // range 200. the first 100 is the support stage. The last one should always be 0.
-    sampleLen = 0;
-    _skipStep[0] = skipStep[0];
-    _skipStep[1] = skipStep[1];
-    edge = _nSample * 0.05;
-    float step = 1;
-    int pickIndex = 0;
-    for (int i = 0; i < _nSample; i++) {
-      precalcCos[i] = -cos(i * 2 * 3.14159 / _nSample);
-      pick[i] = -1;
-      if (i > edge && i < _nSample / 2 - edge) {
-        step = _skipStep[0];  // support stage
-      } else
-        step = _skipStep[1];  // swing stage
-      if (i == pickIndex) {
-        pick[i] = sampleLen;
-        pickIndex += step;
-        sampleLen++;
-      }
-    }
-    PTHL("sampleLen", sampleLen);
-  }
-
-  ~CPG() {
-    delete[] precalcCos;
-    delete[] pick;
-    if (sample != nullptr) { delete[] sample; }
-    if (supportStage != nullptr) { delete[] supportStage; }
-  }
-  void setPar(int8_t amplitude, int8_t sideRatio, int8_t stateSwitchAngle, int8_t loopDelay, int8_t midShift[],
-              int8_t phase[]) {
-    _amplitude = amplitude;
-    _sideRatio = sideRatio;
-    _stateSwitchAngle = stateSwitchAngle;
-    _loopDelay = loopDelay;
-    _midShift[0] = midShift[0];
-    _midShift[1] = midShift[1];
-    for (byte i = 0; i < 4; i++) _phase[i] = phase[i];
-
-    // Release old arrays if they exist
-    if (sample != nullptr) { delete[] sample; }
-    if (supportStage != nullptr) { delete[] supportStage; }
-
-    sample = new float[sampleLen];
-    supportStage = new bool[sampleLen];
-    sampleLen = 0;
-
-    for (int8_t l = 0; l < 5; l++) {
-      shiftIndex[l] = _phase[l] / 100.0 * _nSample;
-      for (int i = 0; i < _nSample; i++) {
-        int j = (shiftIndex[l] + i) % _nSample;
-        if (pick[j] >= 0) {
-          if (l == 4) {  // calculate the 0 shift sample, no stateSwitchAngle here
-            sample[sampleLen] = precalcCos[j];
-            supportStage[sampleLen] = (i > edge && i < _nSample / 2 - edge);  // mark support stage
-            sampleLen++;
-          } else {
-            shiftIndex[l] = pick[j];
-            Serial.print(shiftIndex[l]);
-            break;
-          }
-        }
-      }
-      Serial.println();
-    }
-  }
-  void sendSignal() {
-    int prevAngle[4];
-    float leftRatio = _sideRatio > 0 ? 1 : (10 + _sideRatio) / 10.0;
-    float rightRatio = _sideRatio > 0 ? (10 - _sideRatio) / 10.0 : 1;
-    PTHL(leftRatio, rightRatio);
-    for (int m = 0; m < sampleLen; m++) {
-      for (int8_t l = 0; l < 4; l++) {
-        int sampleIndex = (m + shiftIndex[l]) % sampleLen;
-        float ratio = (l % 3 ? rightRatio : leftRatio);
-
-        // Calculate base angle with ratio
-        float angle = _amplitude * ratio * sample[sampleIndex];
-
-        // Add stateSwitchAngle for support stage (not affected by ratio)
-        if (supportStage[sampleIndex]) { angle += _stateSwitchAngle; }
-
-        calibratedPWM(8 + l, angle + _midShift[l < 2 ? 0 : 1]);
-      }
-      delay(_loopDelay);
-    }
-  }
-  void printCPG() {
-    printToAllPorts("Amp\tside\tswitch\tShiftF\tShiftB\tdelay\tSupport\tSwing\tPhase");
-    char message[50];
-    sprintf(message, "%d\t%0.1f\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d", _amplitude, _sideRatio / 10.0,
-            _stateSwitchAngle, _midShift[0], _midShift[1], _loopDelay, _skipStep[0], _skipStep[1], _phase[0], _phase[1],
-            _phase[2], _phase[3]);
-    printToAllPorts(message);
-  }
-};
-CPG* cpg = NULL;
+CPG cpgEngine(300, skipStep);  // the only instance. r and Q reconfigure it in place
+CPG* cpg = NULL;               // NULL until the first r or Q command
+void cpgTick() {
+  float out[DOF];
+  bool activeQ[DOF] = {};
+  cpg->tick(out, activeQ);
+  submitFrame(out, activeQ);
+}
 void updateCPG() {
   char* pch;
   char subToken = newCmd[0];
@@ -336,8 +247,8 @@ void updateCPG() {
     } else if (subToken == 'k') {
       skipStep[0] = pars[0];
       skipStep[1] = pars[1];
-      if (cpg != NULL) delete cpg;
-      cpg = new CPG(600, skipStep);
+      cpg = &cpgEngine;
+      cpg->setSteps(600, skipStep);
     } else if (subToken == 'a')  // amplitude
       amplitude = pars[0];
     else if (subToken == 'd')
@@ -349,11 +260,9 @@ void updateCPG() {
       shift[0] = pars[0];
       shift[1] = pars[1];
     }
-    if (cpg == NULL)
-      cpg = new CPG(300, skipStep);
-    else if (skipStep[0] != cpg->_skipStep[0] || skipStep[1] != cpg->_skipStep[1]) {
-      delete cpg;
-      cpg = new CPG(300, skipStep);
+    if (cpg == NULL || skipStep[0] != cpg->_skipStep[0] || skipStep[1] != cpg->_skipStep[1]) {
+      cpg = &cpgEngine;  // the running cycle keeps its phase
+      cpg->setSteps(300, skipStep);
     }
     cpg->setPar(amplitude, sideRatio, stateSwitchAngle, loopDelay, shift, phase);
     if (subToken == 'q') {
@@ -397,215 +306,162 @@ void autoCalibrate() {
   measureServoPin = 16;  // reattach the servos in the next reaction loop
 }
 
-void signalGenerator(int8_t resolution, int8_t speed, int8_t* pars, int8_t len, bool move = 1,
-                     char curveMethod = 't') {  // trigonometric
-  // circular
+SignalGenerator signalGen;  // ticked by reaction() while the token is T_SIGNAL_GEN or T_SIGNAL_WAVE
+
+// o [shape] resolution speed joint midpoint amp freq phase [joint midpoint amp freq phase ...]
+// shape: s sine (default), t triangle, q square, u0 ~ u3 the uploaded shapes. e.g. "ot 10 4 8 30 20 1 0"
+// the listed joints are added to the running ones. "o" alone stops the generator
+void signalGenerator(char* cmd, bool continueQ) {
+  if (!continueQ) signalGen.clear();
+  uint8_t shape = WAVE_SINE;
+  switch (cmd[0]) {
+    case 't': shape = WAVE_TRIANGLE; break;
+    case 'q': shape = WAVE_SQUARE; break;
+    case 'u': shape = WAVE_USER + (isdigit(cmd[1]) ? cmd[1] - '0' : 0) % WAVE_USER_SLOTS; break;
+  }
+  if (isalpha(cmd[0])) {
+    cmd++;
+    if (shape >= WAVE_USER && isdigit(cmd[0])) cmd++;
+  }
+  int8_t pars[2 + 5 * SIGNAL_MAX_JOINTS];
+  int len = 0;
+  for (char* pch = strtok(cmd, " ,\t"); pch != NULL && len < 2 + 5 * SIGNAL_MAX_JOINTS; pch = strtok(NULL, " ,\t"))
+    pars[len++] = atoi(pch);
+  if (len < 7) {  // nothing to add
+    if (!len) signalGen.clear();
+    return;
+  }
   int targetFrame[DOF + 1];
-  // arrayNCPY(targetFrame, currentAng, DOF);
   for (int i = 0; i < DOF; i++) targetFrame[i] = currentAng[i];
-  for (int t = 0; t < 360; t += resolution) {
-    for (int8_t i = 0; i < len / 5; i++) {
-      int8_t jointIdx = pars[i * 5];
-      int8_t midpoint = pars[i * 5 + 1];
-      int8_t amp = pars[i * 5 + 2];
-      int8_t freq = pars[i * 5 + 3];
-      int8_t phase = pars[i * 5 + 4];
-      // PTHL("len", (len + 1) / 5);
-      // PTHL("jointIdx", jointIdx);
-      // PTHL("amp", amp);
-      // PTHL("freq", freq);
-      // PTHL("phase", phase);
-      // PTHL("midpoint", midpoint);
-      int angle = 0;
-      if (curveMethod == 't')  // currently we set sin function as the default and only option
-        // angle = round(amp * sin(M_PI * 2.0 * freq * (t + phase*3/freq) / 360.0)) + midpoint;//phase: 120 => 1 full
-        // period else if(curveMethod == 'c')
-        angle = midpoint + round(amp * sin(2.0 * M_PI * ((t + phase * 3 / freq) / (360.0 / freq))));
-      PTT(angle, ',');
-      targetFrame[jointIdx] = angle;
+  bool startQ = !signalGen.count;
+  for (int i = 2; i + 5 <= len; i += 5) {
+    if (pars[i] < 0 || pars[i] >= DOF) continue;
+    if (!signalGen.set(pars[i], pars[i + 1], pars[i + 2], pars[i + 3], pars[i + 4], pars[0], pars[1], shape)) {
+      PTLF("Too many joints");
+      break;
     }
-    if (move) transform(targetFrame, 1, speed);
-    PTL();
+  }
+  if (startQ) {  // move to the first samples smoothly. from here on the joints only take small steps
+    for (byte i = 0; i < signalGen.count; i++) targetFrame[signalGen.osc[i].joint] = signalGen.angle(i);
+    transform(targetFrame, 1, max(int8_t(1), pars[1]));
   }
 }
-#define MAX_FRAME 125
+
+void signalTick() {  // one output of all the oscillating joints. call it every GAIT_UPDATE_MS
+  int angle[DOF];
+  bool activeQ[DOF] = {};
+  for (byte i = 0; i < signalGen.count; i++) {
+    angle[signalGen.osc[i].joint] = signalGen.angle(i);
+    activeQ[signalGen.osc[i].joint] = true;
+  }
+  submitFrame(angle, activeQ);
+  signalGen.advance();
+}
+
+#define MAX_FRAME LEARN_MAX_FRAME  // the frames of a recording that fit in learnData after smoothMerge()
 #define IDLE_LEARN 2000
 #define SMALL_DIFF 7
 #define READY_COUNTDOWN 2
+#define LEARN_DIR "/learn"          // the recordings in LittleFS. see learnLog.h
+#define LEARN_LAST "last"           // the recording of the last fl
+#define LEARN_LOG_MAX (256 * 1024)  // bytes of a recording. about 10 minutes of dragging
 int totalFrame = 0;
 int8_t learnData[11 * MAX_FRAME];
 int8_t learnDataPrev[11];
 
-// Function to print comparison arrays
-void printComparisonArrays(int8_t* originalData, int originalTotalFrame, int8_t* optimizedData, int newTotalFrame) {
-  // Print original data
-  printToAllPorts("=== Original Data ===");
-  printToAllPorts("{");
-  for (int i = 0; i < originalTotalFrame; i++) {
-    for (int j = 0; j < 11; j++) {
-      printToAllPorts(String(originalData[i * 11 + j]) + ",", false);  // No newline after each value
-    }
-    printToAllPorts("");                                               // Print newline to end the frame
-  }
-  printToAllPorts("}");
-
-  // Print optimized data
-  printToAllPorts("=== Optimized Data ===");
-  printToAllPorts("{");
-  for (int i = 0; i < newTotalFrame; i++) {
-    for (int j = 0; j < 11; j++) {
-      printToAllPorts(String(optimizedData[i * 11 + j]) + ",", false);  // No newline after each value
-    }
-    printToAllPorts("");                                                // Print newline to end the frame
+bool learnFsReady() {  // mount LittleFS the first time a recording is used
+  static bool readyQ = false;
+  if (!readyQ) {
+    readyQ = LittleFS.begin(true);  // format the partition if it has never been used
+    if (readyQ)
+      LittleFS.mkdir(LEARN_DIR);
+    else
+      PTLF("No file system for the recordings");
   }
-  printToAllPorts("}");
+  return readyQ;
 }
 
-// Optimize learned data by removing intermediate frames while preserving local extrema
-void smoothMerge() {
-  if (totalFrame <= 3) return;  // No optimization needed for less than 4 frames
-
-  bool keepFrame[MAX_FRAME];
-  int totalChange[MAX_FRAME];
-
-  // Initialize arrays
-  for (int i = 0; i < totalFrame; i++) {
-    keepFrame[i] = false;
-    totalChange[i] = 0;
-  }
-
-  // Always keep the first and last frames
-  keepFrame[0] = true;
-  keepFrame[totalFrame - 1] = true;
-
-  // Calculate total change amount for each frame
-  for (int frame = 1; frame < totalFrame - 1; frame++) {
-    int frameChange = 0;
-    for (int joint = 0; joint < 11; joint++) {
-      int8_t prev = learnData[(frame - 1) * 11 + joint];
-      int8_t curr = learnData[frame * 11 + joint];
-      int8_t next = learnData[(frame + 1) * 11 + joint];
-
-      // Calculate the change amount for this joint in this frame
-      int jointChange = abs(curr - prev) + abs(next - curr);
-      frameChange += jointChange;
-    }
-    totalChange[frame] = frameChange;
-  }
-
-  // Find statistics of change amounts
-  int maxChange = 0;
-  int minChange = 10000;
-  int avgChange = 0;
-
-  for (int i = 1; i < totalFrame - 1; i++) {
-    maxChange = max(maxChange, totalChange[i]);
-    minChange = min(minChange, totalChange[i]);
-    avgChange += totalChange[i];
-  }
-  avgChange /= (totalFrame - 2);
-
-  // Balanced threshold: keep frames with significant changes
-  int threshold = avgChange * 1.2;  // More selective threshold
-
-  PTHL("Average Change:", avgChange);
-  PTHL("Max Change:", maxChange);
-  PTHL("Threshold:", threshold);
+void learnPath(char* path, const char* name) {  // path: sizeof(LEARN_DIR) + CMD_LEN + 1 bytes
+  while (*name == ' ') name++;
+  sprintf(path, "%s/%.*s", LEARN_DIR, CMD_LEN, *name ? name : LEARN_LAST);
+}
 
-  // Keep frames based on threshold
-  for (int frame = 1; frame < totalFrame - 1; frame++) {
-    if (totalChange[frame] > threshold) { keepFrame[frame] = true; }
+// read a recording into learnData. the frames are merged every time learnData fills up, so a long recording fits as
+// long as its kept frames do
+bool loadLearn(const char* name) {
+  char path[sizeof(LEARN_DIR) + CMD_LEN + 1];
+  learnPath(path, name);
+  File file;
+  if (!learnFsReady() || !(file = LittleFS.open(path, "r"))) {
+    PTHL("No recording", path);
+    return false;
   }
-
-  // Check local extrema for all joints with unified threshold
-  for (int joint = 0; joint < 11; joint++) {
-    for (int frame = 1; frame < totalFrame - 1; frame++) {
-      int8_t prev = learnData[(frame - 1) * 11 + joint];
-      int8_t curr = learnData[frame * 11 + joint];
-      int8_t next = learnData[(frame + 1) * 11 + joint];
-
-      // Check if it's a significant local extrema
-      if (((curr > prev && curr > next) || (curr < prev && curr < next)) &&
-          (abs(curr - prev) > 15 || abs(next - curr) > 15)) {
-        keepFrame[frame] = true;
-      }
-    }
-  }
-
-  // Check for significant direction changes in important joints (0,1,2,8-15)
-  for (int joint = 0; joint < 11; joint++) {
-    // Skip joints 3-7 as they have small movements
-    if (joint >= 3 && joint <= 7) continue;
-
-    for (int frame = 2; frame < totalFrame - 2; frame++) {
-      int8_t prev2 = learnData[(frame - 2) * 11 + joint];
-      int8_t prev1 = learnData[(frame - 1) * 11 + joint];
-      int8_t curr = learnData[frame * 11 + joint];
-      int8_t next1 = learnData[(frame + 1) * 11 + joint];
-      int8_t next2 = learnData[(frame + 2) * 11 + joint];
-
-      // Check for direction change with meaningful amplitude
-      int prevDir = (prev1 > prev2) ? 1 : -1;
-      int currDir = (curr > prev1) ? 1 : -1;
-      int nextDir = (next1 > curr) ? 1 : -1;
-
-      if (prevDir != currDir || currDir != nextDir) {
-        if (abs(curr - prev1) > 15 || abs(next1 - curr) > 15) { keepFrame[frame] = true; }
+  int8_t frame[LEARN_JOINTS] = {};
+  long recorded = 0;
+  int first = 0;  // the frames before it are merged
+  totalFrame = 0;
+  while (readLearnFrame(file, frame)) {
+    recorded++;
+    if (totalFrame == MAX_FRAME) {
+      totalFrame = smoothMerge(learnData, totalFrame, first);
+      first = totalFrame - 1;  // the last kept frame starts the next segment
+      if (totalFrame == MAX_FRAME) {
+        PTLF("Too many frames to keep. The recording is cut");
+        break;
       }
     }
+    for (int j = 0; j < 11; j++) learnData[totalFrame * 11 + j] = frame[j];
+    totalFrame++;
   }
+  file.close();
+  totalFrame = smoothMerge(learnData, totalFrame, first);
+  PTHL("Recorded Frames:", recorded);
+  PTHL("Optimized Frames:", totalFrame);
+  if (totalFrame) PTHL("Compression ratio:", float(recorded) / totalFrame);
+  return totalFrame > 0;
+}
 
-  // Ensure the interval between adjacent kept frames is not too large
-  for (int i = 0; i < totalFrame - 1; i++) {
-    if (keepFrame[i]) {
-      int nextKeep = -1;
-      for (int j = i + 1; j < totalFrame; j++) {
-        if (keepFrame[j]) {
-          nextKeep = j;
-          break;
-        }
-      }
-
-      // If interval exceeds 12 frames, insert a frame in the middle
-      if (nextKeep > 0 && nextKeep - i > 12) {
-        int midFrame = (i + nextKeep) / 2;
-        keepFrame[midFrame] = true;
-      }
-    }
+void saveLearn(const char* name) {  // copy the last recording to a name
+  char from[sizeof(LEARN_DIR) + CMD_LEN + 1], to[sizeof(LEARN_DIR) + CMD_LEN + 1];
+  learnPath(from, "");
+  learnPath(to, name);
+  if (!learnFsReady() || !strcmp(from, to)) return;
+  File in = LittleFS.open(from, "r");
+  File out = in ? LittleFS.open(to, "w") : File();
+  if (!in || !out) {
+    PTHL("Can't save", to);
+    return;
   }
+  uint8_t buffer[64];
+  for (size_t n; (n = in.read(buffer, sizeof(buffer))) > 0;) out.write(buffer, n);
+  PTHL("Saved", to);
+  in.close();
+  out.close();
+}
 
-  // Save original data for printing first
-  int8_t originalData[11 * MAX_FRAME];
-  for (int i = 0; i < totalFrame * 11; i++) { originalData[i] = learnData[i]; }
-  int originalTotalFrame = totalFrame;
-
-  // Reorganize data, keeping only the needed frames
-  int8_t optimizedData[11 * MAX_FRAME];
-  int newTotalFrame = 0;
-
-  for (int i = 0; i < totalFrame; i++) {
-    if (keepFrame[i]) {
-      for (int j = 0; j < 11; j++) { optimizedData[newTotalFrame * 11 + j] = learnData[i * 11 + j]; }
-      newTotalFrame++;
-    }
+void listLearn() {  // the saved recordings and their sizes in bytes
+  File dir;
+  if (!learnFsReady() || !(dir = LittleFS.open(LEARN_DIR))) return;
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    PTT(f.name(), '\t');
+    PTL(f.size());
   }
-
-  // Copy optimized data back to original array
-  for (int i = 0; i < newTotalFrame * 11; i++) { learnData[i] = optimizedData[i]; }
-
-  PTHL("Original Frames:", originalTotalFrame);
-  PTHL("Optimized Frames:", newTotalFrame);
-
-  // Call function to print comparison arrays (can be toggled on/off)
-  printComparisonArrays(originalData, originalTotalFrame, optimizedData, newTotalFrame);
-
-  // Update total frame count
-  totalFrame = newTotalFrame;
+  PTHL("Free bytes:", LittleFS.totalBytes() - LittleFS.usedBytes());
 }
 
+// record the dragged joints into the LEARN_LAST log until the user sends anything, the joints stay still for
+// IDLE_LEARN ms, or the log is full
 void learnByDrag() {
+  char path[sizeof(LEARN_DIR) + CMD_LEN + 1];
+  learnPath(path, "");
+  File file;
+  if (!learnFsReady() || !(file = LittleFS.open(path, "w"))) {
+    PTHL("Can't record to", path);
+    return;
+  }
   totalFrame = 0;
   int getReady = 0;
+  int8_t frame[LEARN_JOINTS];
 
   while (getReady < READY_COUNTDOWN) {
     PTHL("ready", READY_COUNTDOWN - getReady);
@@ -613,7 +469,6 @@ void learnByDrag() {
     int diff = 0;
     for (int i = 0; i < 11; i++) {
       int j = (i > 2) ? i + 5 : i;
-      learnData[totalFrame * 11 + i] = currentAng[j];
       diff += (currentAng[j] - learnDataPrev[i]) * (currentAng[j] - learnDataPrev[i]);
       learnDataPrev[i] = currentAng[j];
     }
@@ -626,30 +481,37 @@ void learnByDrag() {
   beep(30, 300);
   PTL("Start to record motion");
   long idleLearnTimer = millis();
-  while (totalFrame < MAX_FRAME                      // not exceed the max frame
-         && !Serial.available()                      // not ended by user
-         && millis() - idleLearnTimer < IDLE_LEARN)  // not idle for a long time
+  long logBytes = 0;
+  while (logBytes <= LEARN_LOG_MAX - LEARN_FRAME_MAX_BYTES  // not exceed the log
+         && !Serial.available()                            // not ended by user
+         && millis() - idleLearnTimer < IDLE_LEARN)        // not idle for a long time
   {
     if (!(totalFrame % 10)) PTL(totalFrame);
     readAllFeedbackFast();
     int diff = 0;
     for (int i = 0; i < 11; i++) {
       int j = (i > 2) ? i + 5 : i;
-      learnData[totalFrame * 11 + i] = currentAng[j];
+      frame[i] = currentAng[j];
       diff += (currentAng[j] - learnDataPrev[i]) * (currentAng[j] - learnDataPrev[i]);
     }
     // PTHL("diff", diff);
     if (diff > SMALL_DIFF) {  // won't record if the joints are not moved
-      for (int i = 0; i < 11; i++) learnDataPrev[i] = learnData[totalFrame * 11 + i];
+      size_t n = writeLearnFrame(file, frame, learnDataPrev, totalFrame == 0);
+      if (!n) {
+        PTLF("The flash is full");
+        break;
+      }
+      logBytes += n;
       idleLearnTimer = millis();
       totalFrame++;
     }
   }
+  file.close();
   while (Serial.available()) Serial.read();
   beep(30, 300);
-
-  // Call smoothMerge function to optimize frame data
-  smoothMerge();
+  PTHL("Recorded Frames:", totalFrame);
+  PTHL("Bytes:", logBytes);
+  totalFrame = 0;  // learnData is filled by loadLearn()
 
   tQueue->addTask('k', "up");
   measureServoPin = 16;  // reattach the servos in the next reaction loop
@@ -672,3 +534,20 @@ void performLearn() {
   }
   PTL("};");
 }
+
+void learnToSkill() {  // write learnData into newCmd as the data of a behavior, the same as performLearn() prints
+  int8_t* data = (int8_t*)newCmd;
+  int8_t header[] = {int8_t(-totalFrame), 0, 0, 1, 0, 0, 0};
+  int len = 0;
+  for (byte i = 0; i < sizeof(header); i++) data[len++] = header[i];
+  for (int f = 0; f < totalFrame; f++) {
+    for (int i = 0; i < 11; i++) {
+      data[len++] = learnData[f * 11 + i];
+      if (i == 2)
+        for (byte j = 3; j < 8; j++) data[len++] = 0;
+    }
+    int8_t behavior[] = {8, 0, 0, 0};  // speed, delay, trigger axis, trigger angle
+    for (byte i = 0; i < 4; i++) data[len++] = behavior[i];
+  }
+  data[len] = '~';
+}
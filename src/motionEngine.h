@@ -0,0 +1,123 @@
+/* Non-blocking motion engine.
+
+   transform() used to work out the whole eased path and then loop over every step with a delay in between, so loop()
+   could not read serial, BLE, IR or web input until a posture change was finished. The engine keeps one active
+   trajectory per joint and moves it forward by a single step every time advance() is called from the main loop or a
+   timer. A new target can be submitted at any time; it starts from wherever the joints are.
+
+   The engine only does the trajectory math and has no Arduino dependency, so it can be built on a host to benchmark
+   the step timing. The caller owns the clock and writes the returned angles to the servos (see motionTick() in
+   motionOutput.h).
+
+   The steps follow an easing curve from easing.h. Set easing (the e token) to pick the profile of the following
+   trajectories. submit() latches it, so a change doesn't bend a trajectory that is already running.
+
+   Step n is due stepInterval * (n - 1) ms after the first step, on a grid instead of after the previous step, so a
+   caller with a coarser clock than stepInterval doesn't slow the trajectory down: the 5 ms ticks of the control loop
+   send the 8 ms steps of a full-body transition 10 and 5 ms apart, 8 ms on average. A caller that is late by more
+   than one step skips to the step that is due, up to MOTION_CATCH_UP steps. Beyond that it was stalled, and the grid
+   restarts from the next step instead of jumping.
+*/
+#ifndef MOTION_ENGINE_H
+#define MOTION_ENGINE_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "easing.h"
+
+#define MOTION_CATCH_UP 4  // steps that advance() may skip to get back on the grid
+
+class MotionEngine {
+ public:
+  int origin[DOF];      // joint angles when the trajectory was submitted
+  float target[DOF];    // joint angles at the end of the trajectory
+  int32_t delta[DOF];   // target - origin, in 1/16 degree
+  bool activeJoint[DOF];
+  int steps;            // number of steps of the active trajectory
+  int step;             // the next step to be sent. step > steps means idle
+  uint8_t stepInterval;  // time between two steps on the grid, in ms
+  unsigned long firstStepTime;
+  uint32_t phaseStep;   // easing phase increment per step, in Q24
+  uint8_t easing;       // easing profile of the next trajectories
+  uint8_t profile;      // easing profile of the active trajectory
+
+  MotionEngine() {
+    easingSetup();
+    easing = profile = EASE_COSINE;
+    phaseStep = EASE_PHASE_ONE;
+    steps = 0;
+    step = 1;
+    stepInterval = 0;
+    firstStepTime = 0;
+    for (int i = 0; i < DOF; i++) activeJoint[i] = false;
+  }
+
+  // same arguments as transform(). target[0] is the angle of joint offset.
+  // joints before headSkip are left alone, e.g. when the head is manually controlled during a skill.
+  template <typename T>
+  void submit(const T* dest, const int* current, uint8_t angleDataRatio = 1, float speedRatio = 1, uint8_t offset = 0,
+              uint8_t headSkip = 0) {
+    int maxDiff = 0;
+    for (int i = 0; i < DOF; i++) {
+      activeJoint[i] = i >= offset && i >= headSkip;
+      if (!activeJoint[i]) continue;
+      origin[i] = current[i];
+      target[i] = dest[i - offset] * angleDataRatio;
+      delta[i] = int32_t(round((target[i] - origin[i]) * 16));
+      int diff = abs(int(origin[i] - target[i]));
+      if (diff > maxDiff) maxDiff = diff;
+    }
+    // default speed is 1 degree per step. if the speed ratio is 0, the joints jump to the target in one step
+    steps = speedRatio > 0 ? int(round(maxDiff / 1.0 /*degreeStep*/ / speedRatio)) : 0;
+    step = steps > 0 ? 1 : 0;  // step 0 is where the joints already are
+    phaseStep = easePhaseStep(steps);
+    profile = easing;
+    stepInterval = (DOF - offset) / 2;
+  }
+
+  // a one-step trajectory of the joints flagged in activeQ, such as an output of the CPG. frame[i] is the angle of
+  // joint i
+  template <typename T>
+  void submitFrame(const T* frame, const bool* activeQ) {
+    for (int i = 0; i < DOF; i++) {
+      activeJoint[i] = activeQ[i];
+      if (activeQ[i]) target[i] = frame[i];
+    }
+    steps = 0;
+    step = 0;
+  }
+
+  bool idle() { return step > steps; }
+
+  // stop the active trajectory. the joints stay where the last step left them.
+  void stop() { step = steps + 1; }
+
+  // moves the trajectory to the step that is due at time now (in ms).
+  // dutyAng receives the angles of the joints flagged in activeJoint. returns false if no step was produced.
+  bool advance(unsigned long now, float* dutyAng) {
+    if (idle()) return false;
+    if (step <= 1)
+      firstStepTime = now;
+    else if (stepInterval) {
+      unsigned long due = (now - firstStepTime) / stepInterval + 1;
+      if (due < (unsigned long)step) return false;
+      if (due - step > MOTION_CATCH_UP)  // stalled. start a new grid from this step
+        firstStepTime = now - (step - 1) * stepInterval;
+      else
+        step = due < (unsigned long)steps ? due : steps;
+    }
+    if (step >= steps) {  // land exactly on the target
+      for (int i = 0; i < DOF; i++)
+        if (activeJoint[i]) dutyAng[i] = target[i];
+    } else {
+      int32_t progress = ease(profile, step * phaseStep);
+      for (int i = 0; i < DOF; i++)
+        if (activeJoint[i]) dutyAng[i] = origin[i] + ((delta[i] * progress) >> 15) / 16.0f;
+    }
+    step++;
+    return true;
+  }
+};
+
+#endif
@@ -0,0 +1,114 @@
+/* The output of the joints: the batch output of a frame, the steps of the motion engine and transform().
+
+   Everything that moves the joints ends here: the frames of the skills, the one-step trajectories of the CPG and the
+   signal generator, and the eased transitions of transform(). It uses the calibration and the joint state of RoboDog.h
+   and the servo output of espServo.h, but none of the Arduino core, so a host test can drive it with a mock
+   ServoOutput (see test/allocFreeTest.cpp).
+*/
+#ifndef MOTION_OUTPUT_H
+#define MOTION_OUTPUT_H
+
+// The batch output of a frame. All the joints are converted to duty ticks first, one lookup per joint in the tables of
+// dutyTable.h at half a degree, then written to the servo output (servoOutput.h) back to back, so they start on the
+// same servo period instead of spreading over the frame. A channel that already has its ticks isn't written again.
+// activeQ (optional) picks the joints to move
+template <typename T>
+void servoFrame(const T* angle, const bool* activeQ = NULL, byte offset = 0) {
+  int ticks[PWM_NUM];
+  for (byte s = 0; s < PWM_NUM; s++) ticks[s] = -1;
+  for (byte i = offset; i < DOF; i++) {
+    if ((i > 3 && i < 8) || (activeQ && !activeQ[i])) continue;  // there's no such joint in this configuration
+    float a = max(float(angleLimit[i][0]), min(float(angleLimit[i][1]), float(angle[i])));
+    previousAng[i] = currentAng[i];
+    currentAng[i] = a;
+    byte s = (i > 3) ? i - 4 : i;
+    ticks[s] = angleTicks(servoTicks[s], calibratedZeroPosition[i], rotationDirection[i], a);
+  }
+  outputFrame(servoOut, ticks, PWM_NUM);  // a frame held by a busy bus or a failed burst goes out with the next one
+}
+
+void servoTickFrame(const int* ticks) {  // a frame already in duty ticks, such as Skill::performTicks(). -1 skips
+  outputFrame(servoOut, ticks, PWM_NUM);
+}
+
+void allCalibratedPWM(int* dutyAng, byte offset = 0) {
+  servoFrame(dutyAng, NULL, offset);
+}
+
+MotionEngine motionEngine;
+int pendingTicks[PWM_NUM];  // a frame in duty ticks for the next motionTick(). it replaces the active trajectory
+bool pendingTicksQ = false;
+#ifdef CONTROL_LOOP
+TaskHandle_t TASK_control = NULL;  // the control task sends the steps of the motion engine (controlLoop.h)
+portMUX_TYPE motionMux = portMUX_INITIALIZER_UNLOCKED;
+#define MOTION_LOCK portENTER_CRITICAL(&motionMux)
+#define MOTION_UNLOCK portEXIT_CRITICAL(&motionMux)
+#else
+#define MOTION_LOCK
+#define MOTION_UNLOCK
+#endif
+
+bool motionTick() {  // move the active trajectory one step forward. returns false once there's nothing left to move
+#ifdef CONTROL_LOOP
+  if (TASK_control != NULL && xTaskGetCurrentTaskHandle() != TASK_control)
+    return !motionEngine.idle();  // only report the progress. the step is sent on the next control tick
+#endif
+  if (motionEngine.idle() && !pendingTicksQ) return false;
+  float dutyAng[DOF];
+  bool activeJoint[DOF];
+  int ticks[PWM_NUM];
+  MOTION_LOCK;
+  bool ticksQ = pendingTicksQ;
+  if (ticksQ)
+    for (byte s = 0; s < PWM_NUM; s++) ticks[s] = pendingTicks[s];
+  pendingTicksQ = false;
+  bool stepQ = motionEngine.advance(millis(), dutyAng);
+  for (byte i = 0; i < DOF; i++) activeJoint[i] = motionEngine.activeJoint[i];
+  MOTION_UNLOCK;
+  if (ticksQ) servoTickFrame(ticks);
+  if (stepQ) {
+    if (updateGyroQ && printGyroQ) { print6Axis(); }
+    servoFrame(dutyAng, activeJoint);
+  }
+  return !motionEngine.idle();
+}
+
+void waitForMotion() {  // block until the active trajectory is finished
+  while (motionTick()) delay(1);
+}
+
+void submitTicks(const int* ticks) {  // like a one-step trajectory, but the frame is already in duty ticks
+  MOTION_LOCK;
+  motionEngine.stop();
+  for (byte s = 0; s < PWM_NUM; s++) pendingTicks[s] = ticks[s];
+  pendingTicksQ = true;
+  MOTION_UNLOCK;
+  motionTick();
+}
+
+// a frame of the joints flagged in activeQ, such as an output of the CPG or the signal generator. it goes out as a
+// one-step trajectory, so the motion engine stays the only writer of the joints and the control task sends it
+template <typename T>
+void submitFrame(const T* angle, const bool* activeQ) {
+  MOTION_LOCK;
+  motionEngine.submitFrame(angle, activeQ);
+  MOTION_UNLOCK;
+  motionTick();
+}
+
+template <typename T>
+void transform(T* target, byte angleDataRatio = 1, float speedRatio = 1, byte offset = 0, int period = 0,
+               int runDelay = 8, bool waitQ = true) {
+  PROFILE(PROF_TRANSFORM);
+  // the head motion will be handled by skill.perform()
+  MOTION_LOCK;
+  motionEngine.submit(target, currentAng, angleDataRatio, speedRatio, offset,
+                      (manualHeadQ && token == T_SKILL) ? HEAD_GROUP_LEN : 0);
+  MOTION_UNLOCK;
+  if (waitQ)
+    waitForMotion();
+  else
+    motionTick();  // the first step goes out right away. the rest are sent by the following loops
+}
+
+#endif
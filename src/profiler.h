@@ -0,0 +1,119 @@
+/* Per-stage loop profiler.
+
+   FPS() only tells how many times loop() ran in the last second. The profiler times each stage of loop() and a few
+   expensive calls inside reaction() with the CPU cycle counter, so we can tell which stage is eating the frame budget.
+
+   Put PROFILE(stage) at the top of a block. The cycles from there to the end of the block are added to the stage's
+   histogram. Nested stages are inclusive, e.g. PROF_REACTION contains PROF_PERFORM.
+   Only the loop task is profiled. Calls from the tasks on the other core (e.g. print6Axis() in the control task) are
+   ignored, so the stages add up to the loop time.
+
+   Each histogram has HIST_BUCKETS fixed buckets on a log2 scale with 4 sub-buckets per octave, so the p99 is within
+   1/4 octave of the real value. No heap is used. "?f" prints the min/avg/p99/max of each stage in us, "?F" sends them
+   in cycles as a binary packet. Both reset the statistics.
+*/
+#ifndef PROFILER_H
+#define PROFILER_H
+
+enum ProfileStage {
+  PROF_LOOP,
+  PROF_READ_ENVIRONMENT,
+  PROF_EXCEPTIONS,
+  PROF_INPUT,  // tQueue->popTask() or readSignal()
+  PROF_REACTION,
+  PROF_WEB_SERVER,
+  PROF_PERFORM,
+  PROF_TRANSFORM,
+  PROF_PRINT_6_AXIS,
+  PROF_PRINT_TO_ALL_PORTS,
+  PROF_STAGE_NUM
+};
+const char* profileStageName[] = {"loop", "readEnv", "except", "input", "reaction",
+                                  "web",  "perform", "transf", "6axis", "print"};
+
+#define SUB_BUCKET_BITS 2
+#define HIST_BUCKETS ((32 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS)
+
+#ifdef CONFIG_ARDUINO_RUNNING_CORE  // the core of the loop task
+#define PROFILE_CORE CONFIG_ARDUINO_RUNNING_CORE
+#else
+#define PROFILE_CORE 1
+#endif
+
+#ifdef PROFILER
+class StageHistogram {
+ public:
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t sum;
+  uint32_t bucket[HIST_BUCKETS];
+
+  StageHistogram() {
+    reset();
+  }
+  void reset() {
+    count = 0;
+    minCycles = 0xFFFFFFFF;
+    maxCycles = 0;
+    sum = 0;
+    for (int b = 0; b < HIST_BUCKETS; b++) bucket[b] = 0;
+  }
+  static int bucketIndex(uint32_t cycles) {
+    if (cycles < (1 << SUB_BUCKET_BITS)) return cycles;
+    int msb = 31 - __builtin_clz(cycles);
+    return ((msb - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) +
+           ((cycles >> (msb - SUB_BUCKET_BITS)) & ((1 << SUB_BUCKET_BITS) - 1));
+  }
+  static uint32_t bucketTop(int b) {  // the largest value that falls into bucket b
+    if (b < (1 << SUB_BUCKET_BITS)) return b;
+    int msb = (b >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+    uint32_t base = (uint32_t(1) << msb) + (uint32_t(b & ((1 << SUB_BUCKET_BITS) - 1)) << (msb - SUB_BUCKET_BITS));
+    return base + (uint32_t(1) << (msb - SUB_BUCKET_BITS)) - 1;
+  }
+  void record(uint32_t cycles) {
+    count++;
+    sum += cycles;
+    if (cycles < minCycles) minCycles = cycles;
+    if (cycles > maxCycles) maxCycles = cycles;
+    bucket[bucketIndex(cycles)]++;
+  }
+  uint32_t avg() {
+    return count ? sum / count : 0;
+  }
+  uint32_t percentile(int p) {  // the top of the bucket that holds the p-th percentile, capped by the max
+    if (!count) return 0;
+    uint32_t rank = (uint64_t(count) * p + 99) / 100;
+    uint32_t seen = 0;
+    for (int b = 0; b < HIST_BUCKETS; b++) {
+      seen += bucket[b];
+      if (seen >= rank) return min(bucketTop(b), maxCycles);
+    }
+    return maxCycles;
+  }
+};
+StageHistogram stageHistogram[PROF_STAGE_NUM];
+
+class ProfileScope {
+  uint8_t stage;
+  bool activeQ;
+  uint32_t start;
+
+ public:
+  ProfileScope(uint8_t s) {
+    stage = s;
+    activeQ = xPortGetCoreID() == PROFILE_CORE;
+    start = ESP.getCycleCount();
+  }
+  ~ProfileScope() {
+    if (activeQ) stageHistogram[stage].record(ESP.getCycleCount() - start);
+  }
+};
+#define PROFILE_JOIN(a, b) a##b
+#define PROFILE_NAME(line) PROFILE_JOIN(profileScope, line)
+#define PROFILE(stage) ProfileScope PROFILE_NAME(__LINE__)(stage)
+#else
+#define PROFILE(stage)
+#endif
+
+#endif
@@ -9,6 +9,7 @@ void finishWebCommand();
 #endif
 
 void dealWithExceptions() {
+  PROFILE(PROF_EXCEPTIONS);
   // Handle turning exception regardless of gyroBalanceQ status
   if (imuException == IMU_EXCEPTION_TURNING) {
     PTL("EXCEPTION: turning target reached");
@@ -203,7 +204,39 @@ void dealWithExceptions() {
 // V_real = V_read / vFactor, vFactor = 4096 / 3.3 / ratio
 // a more accurate fitting for V1_0 is V_real = V_read / 515 + 1.95
 
+#ifdef PROFILER
+void printProfile(bool binaryQ) {  // text in us, or binary in cycles: stage count, then count/min/avg/p99/max per stage
+  if (binaryQ) {
+    uint32_t packet[PROF_STAGE_NUM][5];
+    for (byte s = 0; s < PROF_STAGE_NUM; s++) {
+      StageHistogram* h = stageHistogram + s;
+      packet[s][0] = h->count;
+      packet[s][1] = h->count ? h->minCycles : 0;
+      packet[s][2] = h->avg();
+      packet[s][3] = h->percentile(99);
+      packet[s][4] = h->maxCycles;
+    }
+    Serial.write(byte(PROF_STAGE_NUM));
+    Serial.write((uint8_t*)packet, sizeof(packet));  // little endian
+    Serial.write('~');
+  } else {
+    float mhz = getCpuFrequencyMhz();
+    char message[64];
+    printToAllPorts("stage\tcount\tmin\tavg\tp99\tmax(us)");
+    for (byte s = 0; s < PROF_STAGE_NUM; s++) {
+      StageHistogram* h = stageHistogram + s;
+      sprintf(message, "%s\t%u\t%.1f\t%.1f\t%.1f\t%.1f", profileStageName[s], h->count,
+              (h->count ? h->minCycles : 0) / mhz, h->avg() / mhz, h->percentile(99) / mhz, h->maxCycles / mhz);
+      printToAllPorts(message);
+    }
+  }
+  for (byte s = 0; s < PROF_STAGE_NUM; s++) stageHistogram[s].reset();
+}
+#endif
+
 void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever" loop() of OpenCatEsp32.ino
+  PROFILE(PROF_REACTION);
+  ALLOC_CHECK(!newCmdIdx && tolower(token) == T_SKILL && skill->period > 1);
   if (newCmdIdx) {
     // PTLF("-----");
     lowerToken = tolower(token);
@@ -215,8 +248,8 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
     }
     if (token != T_REST && newCmdIdx < 5) idleTimer = millis();
     if (newCmdIdx < 5 && lowerToken != T_BEEP && token != T_MEOW && token != T_LISTED_BIN &&
-        token != T_INDEXED_SIMULTANEOUS_BIN && token != T_TILT && token != T_READ && token != T_WRITE &&
-        token != T_JOYSTICK && token != T_EXTENSION)
+        token != T_INDEXED_SIMULTANEOUS_BIN && token != T_FOOT_BIN && token != T_TILT && token != T_READ &&
+        token != T_WRITE && token != T_JOYSTICK && token != T_EXTENSION)
       beep(15 + newCmdIdx, 5);  // ToDo: check the muted sound when newCmdIdx = -1
     if (!workingStiffness &&
         (lowerToken == T_SKILL || lowerToken == T_INDEXED_SEQUENTIAL_ASC || lowerToken == T_INDEXED_SIMULTANEOUS_ASC)) {
@@ -248,6 +281,13 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
           byte i = 0;
           while (newCmd[i] != '\0') {
             if (newCmd[i] == C_QUERY_PARTITION) displayNsvPartition();
+#ifdef CONTROL_LOOP
+            if (newCmd[i] == C_QUERY_CONTROL) printControlClock();
+#endif
+#ifdef PROFILER
+            if (newCmd[i] == C_QUERY_PROFILE) printProfile(false);
+            if (newCmd[i] == C_QUERY_PROFILE_BIN) printProfile(true);
+#endif
             i++;
           }
         }
@@ -320,14 +360,19 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
           shutServos();
         break;
       }
-      case T_ACCELERATE: {
-        runDelay = max(0, runDelay - 1);
-        PTHL("Run delay", runDelay);
+      case T_ACCELERATE:
+      case T_DECELERATE: {  // '.' or ',' alone changes the gait rate by a step. with a number, it sets the rate
+        if (cmdLen)
+          gaitRate = atof(newCmd);
+        else
+          gaitRate = token == T_ACCELERATE ? gaitRate * GAIT_RATE_STEP : gaitRate / GAIT_RATE_STEP;
+        gaitRate = max(float(GAIT_RATE_MIN), min(float(GAIT_RATE_MAX), gaitRate));
+        PTHL("Gait rate", gaitRate);
         break;
       }
-      case T_DECELERATE: {
-        runDelay = min(delayLong, runDelay + 1);
-        PTHL("Run delay", runDelay);
+      case T_EASING: {  // a single 'e' prints the easing of the transitions
+        if (cmdLen) motionEngine.easing = max(0, min(int(EASE_PROFILE_NUM) - 1, atoi(newCmd)));
+        PTHL("Easing", motionEngine.easing);
         break;
       }
       case T_REST: {
@@ -462,14 +507,15 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
       case T_BALANCE_SLOPE: {
         if (token == T_INDEXED_SIMULTANEOUS_ASC && cmdLen == 0)
           manualHeadQ = false;
+        else if (token == T_BALANCE_SLOPE && isalpha(newCmd[0]))  // lm, lg: the balance controller
+          balanceCommand(newCmd);
         else {
           int targetFrame[DOF + 1];
           // arrayNCPY(targetFrame, currentAng, DOF);
           for (int i = 0; i < DOF; i++) { targetFrame[i] = currentAng[i] - (gyroBalanceQ ? currentAdjust[i] : 0); }
           targetFrame[DOF] = '~';
 
-          char* cmdForParsing = new char[cmdLen + 1];
-          strcpy(cmdForParsing, newCmd);
+          copyJointCmd(newCmd, cmdLen);  // newCmd may be overwritten by loadBySkillName()
           if (token == T_SERVO_CALIBRATE && lastToken != T_SERVO_CALIBRATE) {
 #ifdef VOICE
             if (newCmdIdx == 2) {     // only deactivate the voice module via serial port
@@ -481,29 +527,16 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
             strcpy(newCmd, "calib");  // it will override the newCmd, so we need to backup it with originalCmd
             loadBySkillName(newCmd);
           }
-          char* pch;
-          pch = strtok(cmdForParsing, " ,");
+          char* pch = firstJointPair();
           nonHeadJointQ = false;
           do {  // it supports combining multiple commands at one time
             // for example: "m8 40 m8 -35 m 0 50" can be written as "m8 40 8 -35 0 50"
             // the combined commands should be less than four. string len <=30 to be exact.
             int target[2] = {};
-            int inLen = 0;
-            for (byte b = 0; b < 2 && pch != NULL; b++) {
-              target[b] = atoi(pch);  //@@@ cast
-              pch = strtok(NULL, " ,\t");
-              inLen++;
-            }
+            int inLen = readJointPair(pch, target);
             // PTHL( target[0],target[1]);
-            if ((token == T_INDEXED_SEQUENTIAL_ASC || token == T_INDEXED_SIMULTANEOUS_ASC) && target[0] >= 0 &&
-                target[0] < DOF) {
-              targetFrame[target[0]] = target[1];
-              if (target[0] < 4) {
-                targetHead[target[0]] = target[1];
-                manualHeadQ = true;
-              } else
-                nonHeadJointQ = true;
-            }
+            if (token == T_INDEXED_SEQUENTIAL_ASC || token == T_INDEXED_SIMULTANEOUS_ASC)
+              setJointTarget(targetFrame, target);
             if (token == T_SERVO_CALIBRATE) {
               gyroBalanceQ = false;
               if (target[0] == DOF) {  // auto calibrate all body joints using servos' angle feedback
@@ -530,7 +563,8 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
                 if (target[0] > 3 && target[0] < 8)  // there's no such joint in this configuration
                   continue;
                 int actualServoIndex = (PWM_NUM == 12 && target[0] > 3) ? target[0] - 4 : target[0];
-                servo[actualServoIndex].write(duty);
+                servoOut->stage(actualServoIndex, degreeToTicks(actualServoIndex, duty));
+                servoFlush();
               }
             } else if (token == T_INDEXED_SEQUENTIAL_ASC) {
               transform(targetFrame, 1, 1);
@@ -572,13 +606,12 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
               if (inLen == 2) {
                 balanceSlope[0] = max(-2, min(2, target[0]));
                 balanceSlope[1] = max(-2, min(2, target[1]));
+                balanceGainSetup();
               }
             }
             // delay(5);
           } while (pch != NULL);
 
-          // Release dynamically allocated memory
-          delete[] cmdForParsing;
 
           // For calibration commands, print calibration values after the loop
           if (token == T_SERVO_CALIBRATE) {
@@ -601,7 +634,6 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
           //     skill->convertTargetToPosture();
           //   }
           // }
-          delete[] pch;
         }
         break;
       }
@@ -672,6 +704,24 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
         }
         break;
       }
+      case T_FOOT_BIN: {  // leg0, x0, z0, leg1, x1, z1, ... (binary encoding, mm)
+        int targetFrame[DOF + 1];
+        for (int i = 0; i < DOF; i++) { targetFrame[i] = currentAng[i] - (gyroBalanceQ ? currentAdjust[i] : 0); }
+        targetFrame[DOF] = '~';
+        for (int i = 0; i + 2 < cmdLen; i += 3) {
+          int8_t leg = (int8_t)newCmd[i];
+          if (leg < 0 || leg > 3) continue;
+          float shoulder, knee;
+          if (!legIK((int8_t)newCmd[i + 1], (int8_t)newCmd[i + 2], shoulder, knee, angleLimit[8 + leg],
+                     angleLimit[12 + leg]))
+            PTHL("Out of reach: leg", leg);
+          targetFrame[8 + leg] = round(shoulder);
+          targetFrame[12 + leg] = round(knee);
+        }
+        transform(targetFrame, 1, transformSpeed);
+        skill->convertTargetToPosture(targetFrame);
+        break;
+      }
       case T_EXTENSION: {
         // PTH("cmdLen = ", cmdLen);
         if (newCmd[0] == '?')
@@ -739,32 +789,28 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
         phase[2] = (int8_t)newCmd[10];
         phase[3] = (int8_t)newCmd[11];
 
-        if (cpg == NULL)
-          cpg = new CPG(300, skipStep);
-        else if (skipStep[0] != cpg->_skipStep[0] || skipStep[1] != cpg->_skipStep[1]) {
-          delete cpg;
-          cpg = new CPG(300, skipStep);
+        if (cpg == NULL || skipStep[0] != cpg->_skipStep[0] || skipStep[1] != cpg->_skipStep[1]) {
+          cpg = &cpgEngine;
+          cpg->setSteps(300, skipStep);
         }
         cpg->setPar(amplitude, sideRatio, stateSwitchAngle, loopDelay, shift, phase);
         cpg->printCPG();
         gyroBalanceQ = false;
         break;
       }
-      case T_SIGNAL_GEN:  // resolution, speed, jointIdx, midpoint, amp, freq,phase
+      case T_SIGNAL_GEN:  // [shape] resolution, speed, jointIdx, midpoint, amp, freq, phase, ...
       {
-        char* pch = strtok(newCmd, " ,");
-        int inLen = 0;
-        int8_t pars[60];              // allows 12 joints 5*12 = 60
-        while (pch != NULL) {
-          pars[inLen++] = atoi(pch);  //@@@ cast
-          pch = strtok(NULL, " ,\t");
-        }
-        // for (int i = 0; i < inLen; i++)
-        //   PTT(pars[i], ' ');
-        // PTL();
-        int8_t resolution = pars[0];
-        int8_t speed = pars[1];
-        signalGenerator(resolution, speed, pars + 2, inLen, 1);
+        signalGenerator(newCmd, lastToken == T_SIGNAL_GEN || lastToken == T_SIGNAL_WAVE);
+        break;
+      }
+      case T_SIGNAL_WAVE:  // slot, then WAVE_USER_LEN samples of one cycle (binary encoding)
+      {
+        if (lastToken != T_SIGNAL_GEN && lastToken != T_SIGNAL_WAVE)
+          signalGen.clear();  // the token keeps the generator ticking. don't resume an old signal
+        if (cmdLen != WAVE_USER_LEN + 1 || (int8_t)newCmd[0] < 0 || (int8_t)newCmd[0] >= WAVE_USER_SLOTS)
+          PTLF("Wrong wave length or slot");
+        else
+          setUserWave(newCmd[0], (int8_t*)newCmd + 1);
         break;
       }
 
@@ -779,8 +825,11 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
                               // fIndex: print the servo angle at index
                               // fp: print all angles once
                               // fP: print all angles continuously
-                              // fl: learn skill by manually dragging the joints
-                              // fr: replay the learned skill
+                              // fl: learn skill by manually dragging the joints. it's recorded in LittleFS
+                              // fr [name]: replay the learned skill, or a saved one
+                              // fs name: save the last recording under a name
+                              // fi: list the saved recordings
+                              // fk [name]: load a recording as a skill and run it
         //
         {
           if (!readFeedbackQ) {
@@ -829,10 +878,27 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
               gyroBalanceQ = gyroLag;
             } else if (newCmd[0] == C_REPLAY) {  // perform
               loadBySkillName("up");
-              performLearn();
+              if (loadLearn(newCmd + 1)) performLearn();
               loadBySkillName("up");
               shutServos(0);
               readFeedbackQ = false;
+            } else if (newCmd[0] == C_LEARN_SAVE) {
+              saveLearn(newCmd + 1);
+              readFeedbackQ = false;
+            } else if (newCmd[0] == C_LEARN_LIST) {
+              listLearn();
+              readFeedbackQ = false;
+            } else if (newCmd[0] == C_LEARN_SKILL) {
+              readFeedbackQ = false;
+              if (loadLearn(newCmd + 1)) {
+                learnToSkill();
+                skill->buildSkill();
+                skill->transformToSkill(skill->nearestFrame());
+                manualHeadQ = false;
+                printToAllPorts(token);
+                token = T_SKILL;
+                strcpy(newCmd, "tmp");
+              }
             }
           }
           break;
@@ -847,6 +913,21 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
         strcpy(newCmd, "tmp");
         break;
       }
+      case T_GAIT_SYNTH: {  // stride, height, duty, frames, phase0 ~ phase3, [x, z] (binary encoding). see gaitSynth.h
+        const int8_t* data =
+            cmdLen >= GAIT_SYNTH_MIN_PARS ? gaitCache.get((int8_t*)newCmd, cmdLen, angleLimit + 8) : NULL;
+        if (data == NULL) {
+          PTLF("Wrong gait parameters");
+          break;
+        }
+        skill->buildSkill(data);
+        skill->transformToSkill(skill->nearestFrame());
+        manualHeadQ = false;
+        printToAllPorts(token);
+        token = T_SKILL;
+        strcpy(newCmd, "syn");
+        break;
+      }
       case T_SKILL_DATA:  // takes in the skill array from the serial port, load it as a regular skill object and run it
                           // locally without continuous communication with the master
       {
@@ -884,8 +965,8 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
           // but need more logics for non skill cmd in between
           if (!strcmp(skillName, "bk")) strcpy(skillName, "bkF");
 
-          loadBySkillName(
-              skillName);  // skillName will be overwritten as dutyAngles then recovered from skill->skillName
+          loadBySkillName(skillName,
+                          false);  // the transition runs in the following loops so new commands can still be read
           manualHeadQ = false;
 
           // Handle gait control with arguments
@@ -958,12 +1039,14 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
       //   strcpy(lastCmd, "up");
     }
 
-    if (token != T_SKILL || skill->period > 0) {  // it will change the token and affect strcpy(lastCmd, newCmd)
-      printToAllPorts(token);  // postures, gaits and other tokens can confirm completion by sending the token back
+    if (token == T_SKILL && skill->period > 0)
+      skillAckQ = true;  // postures and gaits confirm completion once the engine reaches the (first) frame
+    else if (token != T_SKILL) {  // it will change the token and affect strcpy(lastCmd, newCmd)
+      printToAllPorts(token);     // other tokens can confirm completion by sending the token back
       if (lastToken == T_SKILL &&
           (lowerToken == T_GYRO || lowerToken == T_INDEXED_SIMULTANEOUS_ASC || lowerToken == T_INDEXED_SEQUENTIAL_ASC ||
            lowerToken == T_PAUSE || token == T_JOINTS || token == T_BALANCE_SLOPE || token == T_ACCELERATE ||
-           token == T_DECELERATE || token == T_TILT))
+           token == T_DECELERATE || token == T_EASING || token == T_TILT))
         token = T_SKILL;
     }
 #ifdef WEB_SERVER
@@ -971,15 +1054,23 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
 #endif
     resetCmd();
   }
-  if (tolower(token) == T_SKILL) {
-    skill->perform();
-    if (skill->period > 1) {
-      delay(delayShort +
-            max(0,
-                int(runDelay - gyroBalanceQ * (max(fabs(ypr[1]) / 2, fabs(ypr[2])) / 20)  // accelerate gait when tilted
-                                   / (!fineAdjustQ && !mpuQ ? 4 : 1)  // reduce the adjust if not using mpu6050
-                    )));
+  if (tolower(token) == T_SKILL && motionTick()) {
+    // still moving to the first frame of the skill. one step per loop keeps the inputs responsive
+    delay(1);  // the steps are sent by the control tick. don't spin on core 1
+  } else if (skillAckQ && motionEngine.idle()) {  // the clients send the next command when they get the ack
+    printToAllPorts(T_SKILL);
+    skillAckQ = false;
+  } else if (tolower(token) == T_SKILL && skill->period > 1 && !frameDue()) {
+    delay(1);  // the next gait frame is not due yet
+  } else if (tolower(token) == T_SKILL) {
+    if (skill->period > 1) {  // runDelay (shortened by exceptions and tilts) still scales the frame time
+      float tiltBoost = gyroBalanceQ * (max(fabs(ypr[1]) / 2, fabs(ypr[2])) / 20)  // accelerate when tilted
+                        / (!fineAdjustQ && !mpuQ ? 4 : 1);  // reduce the adjust if not mpu6050
+      float frameMs = delayShort + max(float(0), runDelay - tiltBoost);
+      frameAdvance = gaitFrameAdvance(gaitRate, GAIT_UPDATE_MS, frameMs);
     }
+    skill->perform();
+    if (skill->period > 1) scheduleFrame(GAIT_UPDATE_MS);
     if (skill->period < 0) {
       if (!strcmp(skill->skillName, "fd")) {  // need to optimize logic to combine "rest" and "fold"
         shutServos();
@@ -997,7 +1088,7 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
         } else
           skill->convertTargetToPosture(currentAng);
       }
-      for (int i = 0; i < DOF; i++) currentAdjust[i] = 0;
+      clearAdjust();
       printToAllPorts(token);  // behavior can confirm completion by sending the token back
 
       if (xyzReal[2] > 0 && (fabs(ypr[1]) > 45 || fabs(ypr[2]) > 45)) {  // wait for imu to update
@@ -1031,12 +1122,22 @@ void reaction() {  // Reminder:  reaction() is repeatedly called in the "forever
       transform((int8_t*)newCmd, 1, 2);
     }
   } else if (token == T_CPG || token == T_CPG_BIN) {
-    if (cpg != NULL) cpg->sendSignal();
+    if (cpg != NULL && frameDue()) {  // one output per control tick. the loop keeps reading the Q stream meanwhile
+      cpgTick();
+      scheduleFrame(GAIT_UPDATE_MS);
+    } else
+      delay(1);
+  } else if (token == T_SIGNAL_GEN || token == T_SIGNAL_WAVE) {
+    if (signalGen.count && frameDue()) {
+      signalTick();
+      scheduleFrame(GAIT_UPDATE_MS);
+    } else
+      delay(1);
   } else if (readFeedbackQ)  // Conditionally read servo feedback and print servo angles
     servoFeedback(measureServoPin);
   // }
-  else {
-    delay(1);  // avoid triggering WDT
+  else if (!motionTick()) {  // finish a transition left by a skill that was interrupted by another token
+    delay(1);                // avoid triggering WDT
   }
 }
 
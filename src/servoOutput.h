@@ -0,0 +1,139 @@
+/* Servo output backends.
+
+   calibratedPWM() (motion.h), servoFrame() (motionOutput.h) and the attach and shut functions in espServo.h send the
+   duty ticks of the servos through a ServoOutput, so the same motion code can drive
+     LedcOutput      the LEDC channels of the ESP32 pins (espServo.h). the default
+     PCA9685Output   a PCA9685 16-channel PWM board on I2C, with PCA9685_SERVO in RoboDog.h. it frees the ESP32 pins
+                     and the LEDC timers for the boards that need more channels
+   stage() sets the ticks of a channel, commit() sends the staged channels. The LEDC writes a channel right away, so
+   its commit() has nothing to do.
+
+   The PCA9685 auto-increments the register address (MODE1_AI), so commit() sends all the changed channels in one I2C
+   transaction from the LEDn_ON_L of the first one to the LEDn_OFF_H of the last one. A whole frame of the 16 channels
+   is one burst from LED0_ON_L instead of the 16 transactions of Adafruit_PWMServoDriver::setPWM(). The outputs of
+   the board change on the STOP (MODE2_OCH = 0), so the channels of a burst start their new pulse together.
+
+   The board shares the bus with the IMU, whose task runs on the other core. commit() takes the lock of the bus
+   (I2cLock in imu.h) without waiting. If the bus is busy or the board doesn't acknowledge the burst, it keeps the
+   staged ticks and returns false, and the next commit() sends them again. commit() sends a copy of the staged ticks
+   and marks that copy as sent, so a stage() from the other task during the burst is sent by the next commit()
+   instead of being taken as sent. Under CONTROL_LOOP the frames of the motion are only staged by the control task
+   (motionTick() in motionOutput.h). The loop task still stages the commands that shut or hold the servos.
+
+   PCA9685Output takes the bus and lock types as template parameters, like learnLog.h takes the file type, so a host
+   build can pass mocks with the same beginTransmission(), write(const uint8_t*, size_t) and endTransmission() as
+   TwoWire, and the same tryLock() and unlock() as I2cLock.
+*/
+#ifndef SERVO_OUTPUT_H
+#define SERVO_OUTPUT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef PCA9685_LED0_ON_L
+#define PCA9685_LED0_ON_L 0x06  // the same as Adafruit_PWMServoDriver.h
+#endif
+#define PCA9685_CHANNELS 16
+#define PCA9685_BURST_LEN (1 + 4 * PCA9685_CHANNELS)  // the register address, then ON_L ON_H OFF_L OFF_H per channel
+#define PCA9685_FULL_OFF 0x1000                       // bit 4 of LEDn_OFF_H. no pulse
+#define PCA9685_OSCILLATOR 25000000                   // Hz. FREQUENCY_OSCILLATOR of Adafruit_PWMServoDriver.h
+
+constexpr int pca9685Clamp(long prescale) {
+  return prescale < 3 ? 3 : (prescale > 255 ? 255 : prescale);
+}
+
+constexpr int pca9685Prescale(int freq) {  // the same as Adafruit_PWMServoDriver::setPWMFreq()
+  return pca9685Clamp((PCA9685_OSCILLATOR + freq * 2048L) / (freq * 4096L) - 1);
+}
+
+class ServoOutput {
+ public:
+  virtual void attach(uint8_t s) = 0;
+  virtual bool attached(uint8_t s) = 0;
+  virtual uint32_t gain(uint8_t s) = 0;           // duty ticks per us in Q16
+  virtual void stage(uint8_t s, int ticks) = 0;  // 0 is no pulse
+  virtual bool commit() = 0;                      // false if the staged ticks are still waiting
+};
+
+// stages the channels of a frame back to back, then commits them. ticks[s] < 0 leaves channel s alone
+bool outputFrame(ServoOutput* out, const int* ticks, uint8_t channels) {
+  for (uint8_t s = 0; s < channels; s++)
+    if (ticks[s] >= 0) out->stage(s, ticks[s]);
+  return out->commit();
+}
+
+// buf: PCA9685_BURST_LEN bytes. returns the bytes of the burst of the channels first ~ last
+size_t packPCA9685Burst(const uint16_t* off, uint8_t first, uint8_t last, uint8_t* buf) {
+  size_t len = 0;
+  buf[len++] = PCA9685_LED0_ON_L + 4 * first;
+  for (uint8_t c = first; c <= last; c++) {  // every pulse starts at tick 0 and ends at off
+    buf[len++] = 0;
+    buf[len++] = 0;
+    buf[len++] = off[c] & 0xFF;
+    buf[len++] = off[c] >> 8;
+  }
+  return len;
+}
+
+template <class Bus, class Lock>
+class PCA9685Output : public ServoOutput {
+  Bus& bus;
+  uint8_t address;
+  Lock* busLock;  // shared with the other devices on the bus. NULL if the board has the bus to itself
+  uint32_t tickGain;
+  uint16_t off[PCA9685_CHANNELS];   // staged
+  uint16_t sent[PCA9685_CHANNELS];  // on the board
+
+ public:
+  uint32_t bursts, bytes;  // sent so far, the register address and data bytes
+
+  PCA9685Output(Bus& b, uint8_t addr, Lock* lock) : bus(b), address(addr), busLock(lock) {
+    tickGain = 0;
+    bursts = bytes = 0;
+    for (uint8_t c = 0; c < PCA9685_CHANNELS; c++) off[c] = sent[c] = PCA9685_FULL_OFF;
+  }
+
+  // after Adafruit_PWMServoDriver::setPWMFreq(). a tick is (prescale + 1) / oscillator seconds
+  void setPrescale(uint32_t oscillator, uint8_t prescale) {
+    tickGain = uint32_t(65536.0 * oscillator / (1000000.0 * (prescale + 1)) + 0.5);
+  }
+
+  void attach(uint8_t s) {}  // the channels of the board are always attached
+  bool attached(uint8_t s) {
+    return true;
+  }
+  uint32_t gain(uint8_t s) {
+    return tickGain;
+  }
+
+  void stage(uint8_t s, int ticks) {
+    off[s] = ticks <= 0 ? PCA9685_FULL_OFF : (ticks > 4095 ? 4095 : ticks);
+  }
+
+  bool commit() {
+    int8_t first = -1, last = -1;
+    for (uint8_t c = 0; c < PCA9685_CHANNELS; c++)
+      if (off[c] != sent[c]) {
+        if (first < 0) first = c;
+        last = c;
+      }
+    if (first < 0) return true;
+    if (busLock && !busLock->tryLock()) return false;
+    uint16_t burst[PCA9685_CHANNELS];  // the ticks that go out. a stage() from the other task meanwhile stays staged
+    for (uint8_t c = first; c <= last; c++) burst[c] = off[c];
+    uint8_t buf[PCA9685_BURST_LEN];
+    size_t len = packPCA9685Burst(burst, first, last, buf);
+    bus.beginTransmission(address);
+    bus.write(buf, len);
+    bool okQ = bus.endTransmission() == 0;
+    if (okQ) {
+      for (uint8_t c = first; c <= last; c++) sent[c] = burst[c];
+      bursts++;
+      bytes += len;
+    }
+    if (busLock) busLock->unlock();  // sent[] is only written under the lock, so two commit() can't cross
+    return okQ;  // if not, the channels are still different from sent[], so the next commit() sends them again
+  }
+};
+
+#endif
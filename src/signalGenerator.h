@@ -0,0 +1,82 @@
+/* Signal generator of joint oscillations.
+
+   Each oscillating joint has a 32-bit phase accumulator. The top 16 bits are the phase of waveSample() in
+   waveTable.h, so every joint shares the same tables, and the lower bits keep the slow rates exact over long runs.
+   angle() and advance() only add, shift and read a table, so one tick of all the joints fits in a control tick
+   and the generator can run for hours (servo burn-in, vibration tests) without holding the loop.
+
+   The rate keeps the meaning of the old blocking signal generator: one resolution step of the 0 ~ 360 sweep per
+   SIGNAL_STEP_TICKS / speed ticks, and freq cycles per sweep. phase is in 1/120 of a cycle.
+
+   Like balancePD.h, there is no Arduino dependency. The caller writes the angles to the servos.
+*/
+#ifndef SIGNAL_GENERATOR_H
+#define SIGNAL_GENERATOR_H
+
+#include <stdint.h>
+
+#define SIGNAL_MAX_JOINTS 12  // the old command took 12 joints at most
+#define SIGNAL_STEP_TICKS 8   // ticks of a resolution step at speed 1
+#define SIGNAL_PHASE_FULL 120
+
+struct Oscillator {
+  int8_t joint;
+  int8_t midpoint;
+  int8_t amplitude;
+  uint8_t shape;   // WAVE_SINE, WAVE_TRIANGLE, WAVE_SQUARE or WAVE_USER + slot
+  uint32_t phase;   // 2^32 is one cycle
+  uint32_t offset;  // the phase argument of set()
+  int32_t step;     // per tick. negative runs the wave backwards
+};
+
+class SignalGenerator {
+ public:
+  Oscillator osc[SIGNAL_MAX_JOINTS];
+  uint8_t count;
+
+  SignalGenerator() {
+    waveSetup();
+    count = 0;
+  }
+
+  void clear() {
+    count = 0;
+  }
+
+  // the joint takes the new wave if it's already oscillating. it keeps its running phase, moved by the change of the
+  // phase argument, so a new rate doesn't make it jump
+  bool set(int8_t joint, int8_t midpoint, int8_t amplitude, int8_t freq, int8_t phase, int8_t resolution,
+           int8_t speed, uint8_t shape) {
+    uint8_t i = 0;
+    while (i < count && osc[i].joint != joint) i++;
+    if (i == SIGNAL_MAX_JOINTS) return false;
+    bool newQ = i == count;
+    if (newQ) count++;
+    Oscillator& o = osc[i];
+    o.joint = joint;
+    o.midpoint = midpoint;
+    o.amplitude = amplitude;
+    o.shape = shape;
+    // cycles per tick = freq * resolution / 360 * speed / SIGNAL_STEP_TICKS
+    double cycles = double(freq) * resolution * (speed > 0 ? speed : 1) / (360.0 * SIGNAL_STEP_TICKS);
+    if (cycles > 0.49) cycles = 0.49;  // about half a cycle per tick is the fastest that isn't aliasing
+    if (cycles < -0.49) cycles = -0.49;
+    o.step = int32_t(cycles * 4294967296.0 + (cycles > 0 ? 0.5 : -0.5));
+    int p = phase % SIGNAL_PHASE_FULL;
+    uint32_t offset = uint32_t(4294967296.0 * (p < 0 ? p + SIGNAL_PHASE_FULL : p) / SIGNAL_PHASE_FULL);
+    o.phase = newQ ? offset : o.phase + (offset - o.offset);
+    o.offset = offset;
+    return true;
+  }
+
+  inline int angle(uint8_t i) {
+    const Oscillator& o = osc[i];
+    return o.midpoint + ((o.amplitude * waveSample(o.shape, o.phase >> 16) + (1 << 14)) >> 15);  // rounded
+  }
+
+  inline void advance() {
+    for (uint8_t i = 0; i < count; i++) osc[i].phase += osc[i].step;
+  }
+};
+
+#endif
@@ -1,96 +1,68 @@
-#define MEMORY_ADDRESS_SIZE 4
-class SkillPreview {
- public:
-  char* skillName;  // use char array instead of String to save memory
-  int period;       // the period of a skill. 1 for posture, >1 for gait, <-1 for behavior
-  int index;
-  SkillPreview(int s) {
-    skillName = new char[strlen(skillNameWithType[s])];
-    strcpy(skillName, skillNameWithType[s]);
-    skillName[strlen(skillNameWithType[s]) - 1] = '\0';  // drop the last charactor of skill type
-    unsigned int pgmAddress = (unsigned int)progmemPointer[s];
-    period = (int8_t)pgm_read_byte(pgmAddress);          // automatically cast to char*
-    index = s;
-  }
-};
-
-class SkillList : public QList<SkillPreview*> {
- public:
-  SkillList() {
-    PT("Build skill list...");
-    PTL(sizeof(skillNameWithType) / MEMORY_ADDRESS_SIZE);
-    for (int s = 0; s < sizeof(progmemPointer) / MEMORY_ADDRESS_SIZE; s++) {
-      SkillPreview* tempAddress = new SkillPreview(s);
-      this->push_back(tempAddress);
-    }
-  }
+GaitCache gaitCache;  // the gaits synthesized by the E token
 
-  int lookUp(const char* key) {
-    byte nSkills = sizeof(progmemPointer) / MEMORY_ADDRESS_SIZE;
-    byte keyLen = strlen(key);
-    char lr = key[keyLen - 1];
-    for (int s = 0; s < nSkills; s++) {
-      char readName[CMD_LEN + 1];
-      strcpy(readName, this->get(s)->skillName);
-      byte nameLen = strlen(readName);
-      if (!strcmp(readName, key)                      // exact match: gait type + F or L, behavior)
-          || (readName[nameLen - 1] != 'F' && strcmp(readName, "bk") && !strncmp(readName, key, keyLen - 1) &&
-              (lr == 'L' || lr == 'R' || lr == 'X'))  // L, R or X
-      ) {
-        printToAllPorts(readName);
-        return s;
-      }
-    }
-    PT('?');   // key not found
-    PT(key);
-    PTL('?');  // it will print ?? in random mode. Why?
-    return -1;
-  }
-};
-SkillList* skillList;
+#ifdef PRECOMPILED_TICKS
+// the frames of the running gait or posture in duty ticks of the walking joints, made by Skill::compileTicks(). the
+// balance adjustment is added with a gain per joint when a frame goes out
+#define TICK_FRAMES 128  // wkL has 116 frames. a longer skill takes the angle path
+uint16_t tickFrames[TICK_FRAMES][WALKING_DOF];
+JointTicks jointTicks[WALKING_DOF];
+#endif
 
-class Skill {
+class Skill : public SkillFrames {  // the frames and the phase of a gait are in SkillFrames (skillFrames.h)
  public:
   char skillName[20];  // use char array instead of String to save memory
   int8_t offsetLR;
-  int period;          // the period of a skill. 1 for posture, >1 for gait, <-1 for behavior
   float transformSpeed;
   byte skillHeader;
-  byte frameSize;
   int expectedRollPitch[2];  // expected body orientation (roll, pitch)
-  byte angleDataRatio;  // divide large angles by 1 or 2. if the max angle of a skill is >128, all the angls will be
-                        // divided by 2
   int8_t loopCycle[3];  // the looping section of a behavior (starting row, ending row, repeating cycles)
-  byte firstMotionJoint;
-  int8_t* dutyAngles;   // the data array for skill angles and parameters
+  int frameBuffer[DOF + 4];  // the last frame fetched by fetchFrame()
+  int8_t posture[DOF];       // the data of a posture converted from the current joint angles
+  bool instinctQ;            // the frames are in flash, so they stay valid after switching to another skill
 
   Skill() {
     skillName[0] = '\0';  // use char array instead of String to save memory
     offsetLR = 0;
-    period = 0;
     transformSpeed = 1;
-    frameSize = 0;
     expectedRollPitch[0] = expectedRollPitch[1] = 0;
-    angleDataRatio = 1;
     loopCycle[0] = loopCycle[1] = loopCycle[2] = 0;
-    firstMotionJoint = 0;
-    dutyAngles = NULL;
+    instinctQ = false;
+    clearOverlay();
   }
   void buildSkill() {  // K token
     strcpy(skillName, "tmp");
     offsetLR = 0;
     period = (int8_t)newCmd[0];  // automatically cast to char*
     dataLen(period);
-    formatSkill();
+    formatSkill((int8_t*)newCmd);
+    encodedQ = false;
+    instinctQ = false;
+    inplaceShift();  // the data stays at the end of newCmd
   }
 
-  void buildSkill(int s) {
+  void buildSkill(int s) {  // the frames are read straight from flash. switching skills doesn't copy any data
     strcpy(skillName, newCmd);
-    unsigned int pgmAddress = (unsigned int)progmemPointer[s];
-    period = (int8_t)pgm_read_byte(pgmAddress);  // automatically cast to char*
-    for (int i = 0; i < dataLen(period); i++) { newCmd[i] = pgm_read_byte(pgmAddress++); }
-    newCmd[dataLen(period)] = '~';
-    formatSkill();
+    const int8_t* data = progmemPointer[s];
+    period = (int8_t)pgm_read_byte(data);  // automatically cast to char*
+    dataLen(period);
+    formatSkill(data);
+    instinctQ = true;
+#ifdef COMPRESSED_SKILLS
+    setFrames(data + skillHeader, true);
+#else
+    setFrames(data + skillHeader, false);
+#endif
+    spaceAfterStoringData = BUFF_LEN;  // newCmd is free for the command input
+  }
+  void buildSkill(const int8_t* data) {  // E token. the frames stay in gaitCache
+    strcpy(skillName, "syn");
+    offsetLR = 0;
+    period = data[0];
+    dataLen(period);
+    formatSkill(data);
+    setFrames(data + skillHeader, false);
+    instinctQ = false;
+    spaceAfterStoringData = BUFF_LEN;
   }
   ~Skill() {}
   int dataLen(int8_t p) {
@@ -119,23 +91,35 @@ class Skill {
     dutyAngles = (int8_t*)newCmd + BUFF_LEN - angleLen;
   }
 
-  void formatSkill() {
+  void formatSkill(const int8_t* data) {  // read the header
     transformSpeed = 1;  // period > 1 ? 1 : 0.5;
     firstMotionJoint = (period <= 1) ? 0 : DOF - WALKING_DOF;
 
     for (int i = 0; i < 2; i++) {
-      expectedRollPitch[i] = (int8_t)newCmd[1 + i];
+      expectedRollPitch[i] = data[1 + i];
+      ::expectedRollPitch[i] = expectedRollPitch[i];  // for the balance of the control task
       yprTilt[2 - i] = 0;
     }
-    angleDataRatio = (int8_t)newCmd[3];
+    angleDataRatio = data[3];
     byte baseHeader = 4;
     if (period < 0) {
-      for (byte i = 0; i < 3; i++) loopCycle[i] = (int8_t)newCmd[baseHeader++];
+      for (byte i = 0; i < 3; i++) loopCycle[i] = data[baseHeader++];
     }
-    inplaceShift();
+    clearOverlay();
+    blendFrom = NULL;
     periodGlobal = period;
   }
 
+  void clearOverlay() {
+    tickFramesQ = false;
+    resetColumns();
+  }
+
+  int* fetchFrame(int k) {
+    for (byte col = 0; col < frameSize; col++) frameBuffer[col] = angle(k, col);
+    return frameBuffer;
+  }
+
   void info() {
     PT("Skill Name: ");
     PTL(skillName);
@@ -159,7 +143,7 @@ class Skill {
     for (int k = 0; k < abs(period); k++) {
       if (abs(period) <= showRows + 2 || k < showRows || k == abs(period) - 1) {
         for (int col = 0; col < frameSize; col++) {
-          PT((int8_t)dutyAngles[k * frameSize + col]);
+          PT(angle(k, col));
           PT(",\t");
         }
         PTL();
@@ -180,45 +164,94 @@ class Skill {
     // It makes the robot more unpredictable and helps it get rid of an infinite loop,
     // such as failed fall-recovering against a wall.
     expectedRollPitch[0] = -expectedRollPitch[0];
-    for (int k = 0; k < abs(period); k++) {
-      if (period <= 1) {                                         // behavior
-        dutyAngles[k * frameSize] = -dutyAngles[k * frameSize];  // head and tail panning angles // avoid mirroring the
-                                                                 // pincers' movements
-        dutyAngles[k * frameSize + 2] = -dutyAngles[k * frameSize + 2];
-      }
-      for (byte col = (period > 1) ? 0 : 2; col < ((period > 1) ? WALKING_DOF : DOF) / 2; col++) {
-        int8_t temp = dutyAngles[k * frameSize + 2 * col];
-        dutyAngles[k * frameSize + 2 * col] = dutyAngles[k * frameSize + 2 * col + 1];
-        dutyAngles[k * frameSize + 2 * col + 1] = temp;
+    ::expectedRollPitch[0] = expectedRollPitch[0];
+    if (period <= 1) {  // behavior
+      for (byte col = 0; col < 3; col += 2) {  // head and tail panning angles // avoid mirroring the pincers' movements
+        colSign[col] = -colSign[col];
+        colOffset[col] = -colOffset[col];
       }
     }
+    for (byte col = (period > 1) ? 0 : 2; col < ((period > 1) ? WALKING_DOF : DOF) / 2; col++) {
+      swapColumns(2 * col, 2 * col + 1);
+    }
+  }
+  void swapColumns(byte a, byte b) {
+    tickFramesQ = false;
+    int8_t temp = colSource[a];
+    colSource[a] = colSource[b];
+    colSource[b] = temp;
+    temp = colSign[a];
+    colSign[a] = colSign[b];
+    colSign[b] = temp;
+    temp = colOffset[a];
+    colOffset[a] = colOffset[b];
+    colOffset[b] = temp;
+  }
+  void shiftAll(int8_t shift) {  // add the same shift to every joint
+    tickFramesQ = false;
+    for (byte col = 0; col < DOF; col++) colOffset[col] += shift;
   }
   void shiftCenterOfMass(int angle) {
     int offset = 8;
     if (period > 1) offset = 0;
-    for (int k = 0; k < abs(period); k++) {
-      // printList(dutyAngles + k * frameSize, frameSize); //compare the angle change
-      float rate = 1.2;
-      if (angle < 0) rate = 0.6;
-      for (byte col = 0; col < 2; col++) {
-        dutyAngles[k * frameSize + offset + col] = dutyAngles[k * frameSize + offset + col] + angle;
-      }
-      for (byte col = 4; col < 6; col++) {
-        dutyAngles[k * frameSize + offset + col] = dutyAngles[k * frameSize + offset + col] - angle * rate;
-      }
-      // printList(dutyAngles + k * frameSize, frameSize);
-    }
+    float rate = 1.2;
+    if (angle < 0) rate = 0.6;
+    tickFramesQ = false;
+    for (byte col = 0; col < 2; col++) colOffset[offset + col] += angle;
+    for (byte col = 4; col < 6; col++) colOffset[offset + col] -= angle * rate;
   }
-  int nearestFrame() {
-    if (period == 1)
-      frame = 0;
-    else  // find the nearest frame using certain algorithm
-      frame = 0;
+  int nearestFrame() {  // the gait frame closest to the current pose, so the transition into the gait is the shortest
+    frame = 0;
+    framePhase = 0;
+    if (period <= 1) return frame;  // postures have one frame. behaviors always start from the first frame
+    int pose[WALKING_DOF];
+    for (byte col = 0; col < WALKING_DOF; col++) {
+      int j = DOF - WALKING_DOF + col;
+      pose[col] = currentAng[j] - long(currentAdjust[j]);
+    }
+    frame = SkillFrames::nearestFrame(pose);
     return frame;
   }
-  void transformToSkill(int frame = 0) {
+#ifdef PRECOMPILED_TICKS
+  // the walking joints of every frame through the overlay, angleDataRatio, the calibration and the duty table of the
+  // servo, once per skill instead of once per frame. false if the skill can't be compiled
+  bool compileTicks() {
+    if (period < 1 || period > TICK_FRAMES) return false;
+    for (byte c = 0; c < WALKING_DOF; c++) {
+      byte j = DOF - WALKING_DOF + c;
+      jointTicks[c] = tickJoint(servoTicks[j - 4], calibratedZeroPosition[j], rotationDirection[j], angleLimit[j]);
+    }
+    for (int k = 0; k < period; k++)  // in order, so a compressed skill is decoded in one pass
+      for (byte c = 0; c < WALKING_DOF; c++) {
+        byte j = DOF - WALKING_DOF + c;
+        int a = angle(k, j - firstMotionJoint) * angleDataRatio;
+        tickFrames[k][c] =
+            frameTicks(servoTicks[j - 4], jointTicks[c], calibratedZeroPosition[j], rotationDirection[j], a);
+      }
+    tickFramesQ = true;
+    return true;
+  }
+
+  // the frame at the current phase from tickFrames. balance scales the adjustment of the joints, 0 without it
+  void performTicks(const float* adjust, float balance) {
+    int k = frame, next = (frame + 1) % period;
+    int32_t phase = int32_t(framePhase * 256);
+    int ticks[PWM_NUM];
+    for (byte s = 0; s < PWM_NUM - WALKING_DOF; s++) ticks[s] = -1;  // the head isn't moved by the frames
+    for (byte c = 0; c < WALKING_DOF; c++) {
+      byte j = DOF - WALKING_DOF + c;
+      const JointTicks& t = jointTicks[c];
+      int tick = blendTicks(t, tickFrames[k][c], tickFrames[next][c], phase, adjust[j] * balance);
+      previousAng[j] = currentAng[j];
+      currentAng[j] = (tick - t.zero) / t.perDegree;
+      ticks[j - 4] = tick;
+    }
+    submitTicks(ticks);
+  }
+#endif
+  void transformToSkill(int frame = 0, bool waitQ = true) {
     //      info();
-    transform(dutyAngles + frame * frameSize, angleDataRatio, transformSpeed, firstMotionJoint, period, runDelay);
+    transform(fetchFrame(frame), angleDataRatio, transformSpeed, firstMotionJoint, period, runDelay, waitQ);
   }
   void convertTargetToPosture(int* targetFrame) {
     int extreme[2];
@@ -228,13 +261,57 @@ class Skill {
       for (int i = 0; i < DOF; i++) targetFrame[i] /= 2;
     } else
       angleDataRatio = 1;
-    arrayNCPY(dutyAngles, targetFrame, DOF);
+    arrayNCPY(posture, targetFrame, DOF);
+    dutyAngles = posture;
+    encodedQ = false;
+    instinctQ = false;
+    blendFrom = NULL;
+    clearOverlay();
+    spaceAfterStoringData = BUFF_LEN;
     period = 1;
     firstMotionJoint = 0;
     frameSize = DOF;
     frame = 0;
+    framePhase = 0;
+  }
+  void performAngles(const float* adjustSnapshot) {  // the frame at the current phase of a posture or gait
+    float frameAng[DOF];
+    for (int jointIndex = 0; jointIndex < DOF; jointIndex++) {
+      //          PT(jointIndex); PT('\t');
+      if (jointIndex == 0) jointIndex = 2;
+      if (jointIndex == 2) jointIndex = DOF - WALKING_DOF;
+      if (jointIndex == 4) jointIndex = 8;
+      //          PT(jointIndex); PT('\t');
+      float duty;
+      if ((abs(period) > 1 && jointIndex < firstMotionJoint)   // gait and non-walking joints
+          ||
+          (abs(period) == 1 && jointIndex < 4 && manualHeadQ)  // posture and head group and manually controlled head
+      ) {
+        if (!manualHeadQ && jointIndex < 4) {
+          duty = (jointIndex != 1 ? offsetLR : 0)  // look left or right
+                 + 10 * sin((frame + framePhase) * (jointIndex + 2) * M_PI / abs(period));
+        } else
+          duty = currentAng[jointIndex] + max(-20, min(20, (targetHead[jointIndex] - currentAng[jointIndex])));
+        //  - gyroBalanceQ * currentAdjust[jointIndex];
+      } else {
+        duty = gaitAngle(jointIndex - firstMotionJoint, frame, framePhase);
+      }
+      duty = +gyroBalanceQ *
+                 ((!imuException || imuException == IMU_EXCEPTION_LIFTED)  // not exception or the robot is lifted
+                      ? adjustSnapshot[jointIndex]
+                      : 0) /
+                 (!fineAdjustQ && !mpuQ ? 4 : 1)  // reduce the adjust if not using mpu6050
+             + duty;
+      frameAng[jointIndex] = duty;
+    }
+    // the frame goes out as a one-step trajectory so that the motion engine stays the only writer of the joints
+    MOTION_LOCK;
+    motionEngine.submit(frameAng + DOF - WALKING_DOF, currentAng, 1, 0, DOF - WALKING_DOF);
+    MOTION_UNLOCK;
+    motionTick();
   }
   void perform() {
+    PROFILE(PROF_PERFORM);
     if (period < 0) {  // behaviors
       interruptedDuringBehavior = false;
       int8_t repeat = loopCycle[2] >= 0 && loopCycle[2] < 2 ? 0 : loopCycle[2] - 1;
@@ -280,12 +357,12 @@ class Skill {
           return;
         }
         // printToAllPorts("Progress: " + String(c + 1) + "/" + abs(period));
-        //  printList(dutyAngles + c * frameSize);
-        transform(dutyAngles + c * frameSize, angleDataRatio, dutyAngles[DOF + c * frameSize] / 8.0);
+        //  printList(fetchFrame(c));
+        transform(fetchFrame(c), angleDataRatio, angle(c, DOF) / 8.0);
         // if opt out the gyro, the calculation can be really fast
-        if (dutyAngles[DOF + 2 + c * frameSize]) {
-          int triggerAxis = dutyAngles[DOF + 2 + c * frameSize];
-          int triggerAngle = dutyAngles[DOF + 3 + c * frameSize];
+        if (angle(c, DOF + 2)) {
+          int triggerAxis = angle(c, DOF + 2);
+          int triggerAngle = angle(c, DOF + 3);
           float currentYpr = ypr[abs(triggerAxis)];
           float previousYpr = currentYpr;
           long triggerTimer = millis();
@@ -315,7 +392,7 @@ class Skill {
           }
         }
 
-        delay(abs(dutyAngles[DOF + 1 + c * frameSize] * 50));
+        controlDelay(abs(angle(c, DOF + 1) * 50));
 
         if (repeat != 0 && c != 0 && c == loopCycle[1]) {
           // printToAllPorts("Loop remaining: " + String(repeat));
@@ -328,6 +405,7 @@ class Skill {
       // printToAllPorts(token); // avoid printing the token twice. may be introduced to fix some other issues.
     } else {  // postures and gaits
 
+#ifndef CONTROL_LOOP  // otherwise the control task keeps currentAdjust up to date
       if (imuUpdated && gyroBalanceQ && !(frame % imuSkip)) {
         //          PT(ypr[2]); PT('\t');
         //          PT(RollPitchDeviation[0]); PT('\t');
@@ -340,39 +418,20 @@ class Skill {
         }
         imuUpdated = false;
       }
+      if (!(frame % imuSkip) && (!imuException || imuException == IMU_EXCEPTION_LIFTED)) updateAdjust(period == 1);
+#endif
+      const float* adjustSnapshot = currentAdjust;  // the control task may publish a new adjustment meanwhile
 
-      for (int jointIndex = 0; jointIndex < DOF; jointIndex++) {
-        //          PT(jointIndex); PT('\t');
-        if (jointIndex == 0) jointIndex = 2;
-        if (jointIndex == 2) jointIndex = DOF - WALKING_DOF;
-        if (jointIndex == 4) jointIndex = 8;
-        //          PT(jointIndex); PT('\t');
-        float duty;
-        if ((abs(period) > 1 && jointIndex < firstMotionJoint)   // gait and non-walking joints
-            ||
-            (abs(period) == 1 && jointIndex < 4 && manualHeadQ)  // posture and head group and manually controlled head
-        ) {
-          if (!manualHeadQ && jointIndex < 4) {
-            duty = (jointIndex != 1 ? offsetLR : 0)  // look left or right
-                   + 10 * sin(frame * (jointIndex + 2) * M_PI / abs(period));
-          } else
-            duty = currentAng[jointIndex] + max(-20, min(20, (targetHead[jointIndex] - currentAng[jointIndex])));
-          //  - gyroBalanceQ * currentAdjust[jointIndex];
-        } else {
-          duty = dutyAngles[frame * frameSize + jointIndex - firstMotionJoint] * angleDataRatio;
-        }
-        duty = +gyroBalanceQ *
-                   ((!imuException || imuException == IMU_EXCEPTION_LIFTED) ?  // not exception or the robot is lifted
-                        (!(frame % imuSkip) ? adjust(jointIndex, (period == 1)) : currentAdjust[jointIndex])
-                                                                            : 0) /
-                   (!fineAdjustQ && !mpuQ ? 4 : 1)  // reduce the adjust if not using mpu6050
-               + duty;
-        calibratedPWM(jointIndex, duty);
-      }
-      frame += tStep;
-      if (frame >= abs(period)) {
-        frame = 0;
-
+#ifdef PRECOMPILED_TICKS
+      if (!blendFrom && (tickFramesQ || compileTicks()))
+        performTicks(adjustSnapshot, gyroBalanceQ && (!imuException || imuException == IMU_EXCEPTION_LIFTED)
+                                         ? 1.0f / (!fineAdjustQ && !mpuQ ? 4 : 1)
+                                         : 0);
+      else
+#endif
+        performAngles(adjustSnapshot);
+      int cycles = advancePhase(frame, framePhase, (period > 1 ? frameAdvance : 1) * tStep);  // a posture has one frame
+      while (cycles-- > 0) {
         // Check if in cycle counting mode and count completed cycles
         if (cycleCountingMode && period > 1) {
           completedCycles++;
@@ -393,13 +452,22 @@ class Skill {
   }
 };
 Skill* skill;
+Skill* previousGait;  // a copy of the gait that was running, for the crossfade into the next gait
 
-void loadBySkillName(
-    const char* skillName) {  // get lookup information from on-board EEPROM and read the data array from storage
+void loadBySkillName(const char* skillName,
+                     bool waitQ = true) {  // get lookup information from on-board EEPROM and read the data array from
+                                           // storage. waitQ = false returns while the transition is still running
   char lr = skillName[strlen(skillName) - 1];
   int skillIndex;
   skillIndex = skillList->lookUp(skillName);
   if (skillIndex != -1) {
+    // switching from a running gait to another gait crossfades the two instead of stopping at the new first frame
+    bool blendQ = gaitBlendFrames && lastToken == T_SKILL && skill->period > 1 && skill->instinctQ &&
+                  skillList->get(skillIndex)->period > 1;
+    if (blendQ) {
+      *previousGait = *skill;
+      previousGait->blendFrom = NULL;  // a crossfade that was still running ends at its target gait
+    }
     skill->offsetLR = (lr == 'L' ? 30 : (lr == 'R' ? -30 : 0));
     skill->buildSkill(skillList->get(skillIndex)->index);
     strcpy(newCmd, skill->skillName);
@@ -411,8 +479,7 @@ void loadBySkillName(
 
     if (strcmp(newCmd, "calib") && skill->period == 1) {      // for static postures
       int8_t protectiveShift = esp_random() % 60 / 10.0 - 3;  // +- 3.0 degrees
-      for (byte i = 0; i < DOF; i++)
-        skill->dutyAngles[i] += protectiveShift;              // add protective shift to reduce wearing at the same spot
+      skill->shiftAll(protectiveShift);                       // add protective shift to reduce wearing at the same spot
     }
     // skill->info();
     if (lr == 'R'                                                 // 'R' must mirror
@@ -421,7 +488,10 @@ void loadBySkillName(
     )
       skill->mirror();                                            // mirror the direction of a behavior
     coinFace = !coinFace;
-    skill->transformToSkill(skill->nearestFrame());
+    if (blendQ)
+      skill->startBlend(previousGait, gaitBlendFrames, frame, framePhase);
+    else
+      skill->transformToSkill(skill->nearestFrame(), waitQ);
 
     for (byte i = 0; i < HEAD_GROUP_LEN; i++) targetHead[i] = currentAng[i] - currentAdjust[i];
   }
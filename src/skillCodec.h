@@ -0,0 +1,97 @@
+/* Streaming decoder of the compressed skill frames.
+
+   With COMPRESSED_SKILLS, the instinct skills come from InstinctBittleESPCompressed.h, generated by
+   tools/compressSkills.py. The header of a skill is the same as the raw one. Each frame after it starts with a control
+   byte:
+     0x80 | (n - 1)  the previous frame is repeated n times
+     0x00            raw frame: frameSize bytes
+     0x40            delta frame: signed 4-bit deltas of all columns, two per byte, the first one in the low nibble
+     0x20            sparse frame: a bit mask of the changed columns (bit c % 8 of byte c / 8), then their new values
+     0x60            sparse delta frame: the bit mask, then the 4-bit deltas of the changed columns
+   The decoder keeps the current frame, the one before it and the first one, and moves forward one frame at a time as
+   the playback advances. So the interpolation between two neighbouring frames, including the last and the first one of
+   a gait, doesn't decode anything again. Going further back decodes again from the first frame.
+   The current frame and the one before it swap the halves of buffer, so the frame returned by frame(k) still holds
+   frame k after frame(k + 1) is read. The half is kept as an index, not a pointer, so a copy of the decoder (such as
+   the outgoing gait of a crossfade, *previousGait = *skill) decodes into its own buffer.
+*/
+#ifndef SKILL_CODEC_H
+#define SKILL_CODEC_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define CODE_REPEAT 0x80
+#define CODE_DELTA 0x40
+#define CODE_SPARSE 0x20
+
+class FrameDecoder {
+ public:
+  const int8_t* start;  // the first control byte
+  const int8_t* pos;    // the next control byte
+  uint8_t frameSize;
+  int index;            // the frame held in row. -1 before the first frame
+  uint8_t repeat;       // the frames left in a repeated run
+  uint8_t cur;          // the half of buffer holding frame index. the other half holds frame index - 1
+  int8_t buffer[2][DOF + 4];
+  int8_t first[DOF + 4];  // frame 0
+
+  void begin(const int8_t* code, uint8_t size) {
+    cur = 0;
+    start = code;
+    frameSize = size;
+    rewind();
+    next();
+    memcpy(first, buffer[cur], frameSize);
+  }
+
+  void rewind() {
+    pos = start;
+    index = -1;
+    repeat = 0;
+    memset(buffer[cur], 0, frameSize);
+  }
+
+  void next() {
+    index++;
+    cur ^= 1;
+    int8_t* row = buffer[cur];
+    memcpy(row, buffer[cur ^ 1], frameSize);
+    if (repeat) {
+      repeat--;
+      return;
+    }
+    uint8_t control = *pos++;
+    if (control & CODE_REPEAT) {
+      repeat = control & 0x7F;
+      return;
+    }
+    const uint8_t* mask = NULL;
+    if (control & CODE_SPARSE) {
+      mask = (const uint8_t*)pos;
+      pos += (frameSize + 7) / 8;
+    }
+    uint8_t n = 0;  // the number of columns read so far
+    for (uint8_t c = 0; c < frameSize; c++) {
+      if (mask && !(mask[c / 8] >> (c % 8) & 1)) continue;
+      if (control & CODE_DELTA) {
+        uint8_t b = pos[n / 2];
+        row[c] += (n % 2) ? int8_t(b) >> 4 : int8_t(b << 4) >> 4;  // sign extend the nibble
+      } else
+        row[c] = pos[n];
+      n++;
+    }
+    pos += (control & CODE_DELTA) ? (n + 1) / 2 : n;
+  }
+
+  const int8_t* frame(int k) {  // decode up to frame k
+    if (k == index) return buffer[cur];
+    if (k == index - 1) return buffer[cur ^ 1];
+    if (k == 0) return first;
+    if (k < index) rewind();
+    while (index < k) next();
+    return buffer[cur];
+  }
+};
+
+#endif
@@ -0,0 +1,141 @@
+/* The frames of a skill and the phase of a gait.
+
+   SkillFrames reads the joint angles of a skill through the mirror and offset overlay, and through FrameDecoder
+   (skillCodec.h) for a compressed skill. A gait plays from a phase, frame + framePhase, where framePhase in [0, 1)
+   interpolates between frame and frame + 1. The crossfade between two gaits and the search for the frame nearest to a
+   pose are here too. Skill (skill.h) adds the loading, the output and the behaviors on top of it. Nothing here touches
+   the hardware, so the host tests build it.
+*/
+#ifndef SKILL_FRAMES_H
+#define SKILL_FRAMES_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "easing.h"
+#include "skillCodec.h"
+
+// weights of the walking joints in the distance between two poses. a shoulder moves the whole leg, so its error moves
+// the foot about twice as far as the same error of a knee
+const uint8_t nearestFrameWeight[WALKING_DOF] = {2, 2, 2, 2, 1, 1, 1, 1};
+
+// the frames a gait moves forward in an update of updateMs, at rate times the speed of one frame per frameMs
+float gaitFrameAdvance(float rate, int updateMs, float frameMs) {
+  return rate * updateMs / (frameMs < 1 ? 1 : frameMs);
+}
+
+class SkillFrames {
+ public:
+  int period;  // the period of a skill. 1 for posture, >1 for gait, <-1 for behavior
+  uint8_t frameSize;
+  uint8_t angleDataRatio;  // divide large angles by 1 or 2. if the max angle of a skill is >128, all the angls will be
+                           // divided by 2
+  uint8_t firstMotionJoint;
+  const int8_t* dutyAngles;  // the data array for skill angles and parameters. instinct skills are read from flash
+  // the mirror and offset overlay. a joint column col of a frame reads colSign[col] * dutyAngles[colSource[col]] +
+  // colOffset[col], so the skill data is never rewritten (see angle())
+  int8_t colSource[DOF];
+  int8_t colSign[DOF];
+  int8_t colOffset[DOF];
+  FrameDecoder decoder;  // reads the frames of a compressed instinct skill (see skillCodec.h)
+  bool encodedQ;         // the frames at dutyAngles are compressed
+  // the crossfade from the previous gait. both gaits play at the same normalized phase frame / period
+  SkillFrames* blendFrom;  // NULL if no crossfade is running
+  uint8_t blendStep;
+  uint8_t blendLen;
+
+  SkillFrames() {
+    period = 0;
+    frameSize = 0;
+    angleDataRatio = 1;
+    firstMotionJoint = 0;
+    dutyAngles = NULL;
+    encodedQ = false;
+    blendFrom = NULL;
+    resetColumns();
+  }
+
+  void setFrames(const int8_t* frames, bool encoded) {  // the frames after the header
+    dutyAngles = frames;
+    encodedQ = encoded;
+    if (encoded) decoder.begin(frames, frameSize);
+  }
+
+  void resetColumns() {  // no mirror and no offset
+    for (uint8_t col = 0; col < DOF; col++) {
+      colSource[col] = col;
+      colSign[col] = 1;
+      colOffset[col] = 0;
+    }
+  }
+
+  const int8_t* row(int k) {  // the raw data of frame k. sequential reads of a compressed skill decode one frame each
+    return encodedQ ? decoder.frame(k) : dutyAngles + k * frameSize;
+  }
+
+  int angle(int k, uint8_t col) {  // the angle (or behavior parameter) at column col of frame k, after the overlay
+    if (col >= DOF) return row(k)[col];
+    return colSign[col] * row(k)[colSource[col]] + colOffset[col];
+  }
+
+  float angleAt(float position, uint8_t col) {  // interpolate a joint linearly between the two frames around position
+    int k = int(position);
+    int a = angle(k, col);
+    return (a + (angle((k + 1) % abs(period), col) - a) * (position - k)) * angleDataRatio;
+  }
+
+  // the angle of a walking joint at the phase k + phase, crossfaded during a blend
+  float gaitAngle(uint8_t col, int k, float phase) {
+    float target = angleAt(k + phase, col);
+    if (!blendFrom) return target;
+    float from = blendFrom->angleAt((k + phase) * blendFrom->period / period, col);
+    uint32_t blendPhase = (blendStep + phase) * easePhaseStep(blendLen);
+    return from + (target - from) * ease(EASE_COSINE, blendPhase) / EASE_ONE;
+  }
+
+  // crossfade from the gait that was running over len frames. from holds a copy of it. the phase k + phase continues
+  // at the same normalized phase of this gait
+  void startBlend(SkillFrames* from, uint8_t len, int& k, float& phase) {
+    blendFrom = from;
+    blendStep = 0;
+    blendLen = len;
+    float position = (k + phase) * period / from->period;
+    k = int(position);
+    phase = position - k;
+  }
+
+  // moves the phase k + phase forward by frames, and ends a crossfade after blendLen frames. returns the cycles
+  // completed on the way
+  int advancePhase(int& k, float& phase, float frames) {
+    int cycles = 0;
+    phase += frames;
+    while (phase >= 1) {
+      phase -= 1;
+      k++;
+      if (blendFrom && ++blendStep >= blendLen) blendFrom = NULL;
+      if (k < abs(period)) continue;
+      k = 0;
+      cycles++;
+    }
+    return cycles;
+  }
+
+  // the gait frame closest to pose, the angles of the walking joints, so the transition into the gait is the shortest
+  int nearestFrame(const int* pose) {
+    int nearest = 0;
+    long minDistance = -1;
+    for (int k = 0; k < period; k++) {  // in order, so a compressed gait is decoded in one pass
+      long distance = 0;
+      for (uint8_t col = 0; col < WALKING_DOF; col++) {
+        long d = angle(k, col) * angleDataRatio - pose[col];
+        distance += nearestFrameWeight[col] * d * d;
+      }
+      if (minDistance < 0 || distance < minDistance) {
+        minDistance = distance;
+        nearest = k;
+      }
+    }
+    return nearest;
+  }
+};
+
+#endif
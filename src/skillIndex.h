@@ -0,0 +1,86 @@
+/* Index of the instinct skills.
+
+   The skills of skillNameWithType are sorted by name once at boot, so a lookup is a binary search with no copies and
+   no heap. Needs skillNameWithType and progmemPointer of the instinct header.
+*/
+#ifndef SKILL_INDEX_H
+#define SKILL_INDEX_H
+
+#define SKILL_NUM (sizeof(progmemPointer) / sizeof(progmemPointer[0]))
+struct SkillEntry {
+  const char* name;  // points into skillNameWithType. the last char is the skill type
+  byte nameLen;      // without the skill type
+  int8_t period;     // the period of a skill. 1 for posture, >1 for gait, <-1 for behavior
+  byte index;        // index in progmemPointer
+};
+
+// compare a skill name with the key base[0 ~ baseLen - 1] followed by the optional char extra
+int compareSkillName(const SkillEntry* e, const char* base, byte baseLen, char extra = '\0') {
+  byte keyLen = baseLen + (extra != '\0');
+  for (byte i = 0; i < e->nameLen && i < keyLen; i++) {
+    char k = i < baseLen ? base[i] : extra;
+    if (e->name[i] != k) return (unsigned char)e->name[i] - (unsigned char)k;
+  }
+  return int(e->nameLen) - keyLen;
+}
+
+class SkillList {  // the skills sorted by name, so a lookup is a binary search
+  SkillEntry entry[SKILL_NUM];
+
+  int find(const char* base, byte baseLen, char extra = '\0') {
+    int lo = 0, hi = SKILL_NUM - 1;
+    while (lo <= hi) {
+      int mid = (lo + hi) / 2;
+      int c = compareSkillName(entry + mid, base, baseLen, extra);
+      if (c == 0) return mid;
+      if (c < 0)
+        lo = mid + 1;
+      else
+        hi = mid - 1;
+    }
+    return -1;
+  }
+
+ public:
+  SkillList() {
+    PT("Build skill list...");
+    PTL(SKILL_NUM);
+    for (int s = 0; s < int(SKILL_NUM); s++) {  // insertion sort. the list is built once at boot
+      SkillEntry e;
+      e.name = skillNameWithType[s];
+      e.nameLen = strlen(skillNameWithType[s]) - 1;  // drop the last charactor of skill type
+      e.period = (int8_t)pgm_read_byte(progmemPointer[s]);
+      e.index = s;
+      int i = s;
+      for (; i > 0 && compareSkillName(entry + i - 1, e.name, e.nameLen) > 0; i--) entry[i] = entry[i - 1];
+      entry[i] = e;
+    }
+  }
+
+  SkillEntry* get(int i) { return entry + i; }
+
+  int lookUp(const char* key) {
+    byte keyLen = strlen(key);
+    char lr = key[keyLen - 1];
+    int s = find(key, keyLen);  // exact match: gait type + F or L, behavior
+    if (s == -1 && keyLen > 1 && (lr == 'L' || lr == 'R' || lr == 'X')) {
+      s = find(key, keyLen - 1, 'L');  // L, R or X of a gait is built from its L version
+      if (s == -1) s = find(key, keyLen - 1);  // postures and behaviors without direction
+    }
+    if (s != -1) {
+      char readName[CMD_LEN + 1];
+      byte len = min(int(entry[s].nameLen), CMD_LEN);
+      strncpy(readName, entry[s].name, len);
+      readName[len] = '\0';
+      printToAllPorts(readName);
+      return s;
+    }
+    PT('?');   // key not found
+    PT(key);
+    PTL('?');  // it will print ?? in random mode. Why?
+    return -1;
+  }
+};
+SkillList* skillList;
+
+#endif
@@ -1,43 +1,76 @@
 long taskTimer = 0;
 long taskInterval = -1;
+#define TASK_QUEUE_LEN 16  // tasks are kept in a fixed ring, so queuing a task doesn't touch the heap
+#define TASK_PARA_LEN 64   // a task with longer parameters is rejected
 class Task {
  public:
   char tkn;
-  char* parameters;
+  char parameters[TASK_PARA_LEN + 1];
   int paraLength;
   int dly;
+  Task() : tkn{'\0'}, paraLength{0}, dly{0} { parameters[0] = '\0'; }
   template <typename T>
-  Task(char t, T* p, int d = 0) : tkn{t}, dly{d} {
-    paraLength = (tkn >= 'A' && tkn <= 'Z') ? strlenUntil(p, '~') : strlen((char*)p);
-    parameters = new char[paraLength + 1];
+  bool set(char t, T* p, int d = 0) {  // false if the parameters don't fit. a cut skill or joint list is another motion
+    int len = (t >= 'A' && t <= 'Z') ? strlenUntil(p, '~') : strlen((char*)p);
+    if (len > TASK_PARA_LEN) {
+      PTHL("Task rejected. Parameters longer than", TASK_PARA_LEN);
+      return false;
+    }
+    tkn = t;
+    dly = d;
+    paraLength = len;
     arrayNCPY(parameters, p, paraLength);
     parameters[paraLength] = (tkn >= 'A' && tkn <= 'Z') ? '~' : '\0';
     // PTL("create task ");
     // info();
-  };
-  ~Task() {
-    // if (paraLength)
-    delete[] parameters;
+    return true;
   };
   void info() { printCmdByType(tkn, parameters); }
 };
 
-class TaskQueue : public QList<Task*> {
+class TaskQueue {
+  Task ring[TASK_QUEUE_LEN];
+  byte head;   // index of the front task
+  byte count;  // number of queued tasks
+
  public:
   Task* lastTask;
   TaskQueue() {
     PTLF("TaskQ");
+    head = count = 0;
     lastTask = NULL;
   };
+  int size() { return count; }
+  Task* front() { return ring + head; }
+  void pop_front() {
+    if (count) {
+      head = (head + 1) % TASK_QUEUE_LEN;
+      count--;
+    }
+  }
   template <typename T>
-  void addTask(char t, T* p, int d = 0) {
+  bool addTask(char t, T* p, int d = 0) {  // false if the task is rejected
     // PTH("add ", p);
-    this->push_back(new Task(t, p, d));
+    if (count == TASK_QUEUE_LEN) {
+      PTLF("Task rejected. Task queue full");
+      return false;
+    }
+    if (!ring[(head + count) % TASK_QUEUE_LEN].set(t, p, d)) return false;
+    count++;
+    return true;
   }
   template <typename T>
-  void addTaskToFront(char t, T* p, int d = 0) {
+  bool addTaskToFront(char t, T* p, int d = 0) {
     PTH("add front", p);
-    this->push_front(new Task(t, p, d));
+    if (count == TASK_QUEUE_LEN) {
+      PTLF("Task rejected. Task queue full");
+      return false;
+    }
+    byte front = (head + TASK_QUEUE_LEN - 1) % TASK_QUEUE_LEN;
+    if (!ring[front].set(t, p, d)) return false;
+    head = front;
+    count++;
+    return true;
   }
   void createTask() {  // use 'q' to start the sequence.
                        // add subToken followed by the subCommand
@@ -45,6 +78,7 @@ class TaskQueue : public QList<Task*> {
                        // add '~' to end the sub command
                        // example: qk sit:1000~m 8 0 8 -30 8 0:500~
     // PTL(newCmd);
+    byte queued = count;
     char* sub;
     sub = strtok(newCmd, ":");
     while (sub != NULL) {
@@ -54,15 +88,16 @@ class TaskQueue : public QList<Task*> {
       if (*sub == '\0') break;
       int subLen = strlen(sub);
       PTHL("sublen", subLen);
-      char* subCmd = new char[subLen + 1];
-      strcpy(subCmd, sub);
+      char* subCmd = sub;  // strtok already ended it with '\0'. the following calls only touch the rest of newCmd
       sub = strtok(NULL, ">");
       int subDuration = atoi(sub);
       sub = strtok(NULL, ":");
       PTH(subToken, subCmd);
       PTHL(": ", subDuration);
-      this->addTask(subToken, subCmd, subDuration);
-      delete[] subCmd;
+      if (!this->addTask(subToken, subCmd, subDuration)) {  // run the whole sequence or none of it
+        count = queued;
+        break;
+      }
     }
     // this->addTask('k', "up");
   }
@@ -78,6 +113,7 @@ class TaskQueue : public QList<Task*> {
     newCmdIdx = 5;
   }
   void popTask() {
+    PROFILE(PROF_INPUT);
     if (long(millis() - taskTimer) > taskInterval) {
       if (this->size() > 0) {
         loadTaskInfo(this->front());
@@ -213,7 +213,8 @@ void resetCmd() {
   lastToken = token;
   newCmdIdx = 0;
   if (token != T_SKILL && token != T_SKILL_DATA && token != T_SERVO_CALIBRATE && token != T_SERVO_FEEDBACK &&
-      token != T_SERVO_FOLLOW && token != T_CPG && token != T_CPG_BIN)
+      token != T_SERVO_FOLLOW && token != T_CPG && token != T_CPG_BIN &&
+      token != T_SIGNAL_GEN && token != T_SIGNAL_WAVE)
     token = '\0';
   newCmd[0] = '\0';
   cmdLen = 0;
@@ -0,0 +1,89 @@
+/* Shared waveform table.
+
+   One cycle of sin() sampled once into WAVE_TABLE_LEN + 1 int16 entries in Q15 (WAVE_ONE is 1.0). Every oscillator
+   reads it through a phase, so no configuration needs its own copy of the waveform, and changing a configuration
+   doesn't allocate or compute any sample.
+
+   The phase is a uint16_t: 0 ~ 65535 is one cycle, so it wraps by itself. The top WAVE_TABLE_BITS bits pick the
+   entry and the rest interpolate linearly to the next one.
+
+   waveSample() adds the other shapes of the signal generator on the same phase:
+     WAVE_TRIANGLE  computed from the phase, with the peaks where sin() has them
+     WAVE_SQUARE    the triangle scaled and clipped, so each edge ramps over WAVE_SQUARE_SLEW of a cycle instead of
+                    jumping. a servo can't follow a real step anyway
+     WAVE_USER + k  the user shape in slot k, WAVE_USER_LEN samples uploaded with the O token
+*/
+#ifndef WAVE_TABLE_H
+#define WAVE_TABLE_H
+
+#include <math.h>
+#include <stdint.h>
+
+#define WAVE_TABLE_BITS 8
+#define WAVE_TABLE_LEN (1 << WAVE_TABLE_BITS)
+#define WAVE_ONE 32767  // 1.0 in Q15
+#define WAVE_PHASE_BITS 16
+#define WAVE_QUARTER (1 << (WAVE_PHASE_BITS - 2))  // a quarter of a cycle
+
+#define WAVE_SINE 0
+#define WAVE_TRIANGLE 1
+#define WAVE_SQUARE 2
+#define WAVE_USER 3
+#define WAVE_USER_SLOTS 4
+#define WAVE_USER_BITS 6
+#define WAVE_USER_LEN (1 << WAVE_USER_BITS)
+#define WAVE_USER_FULL 125       // the uploaded sample of 1.0. 126 is '~', the end of a binary command
+#define WAVE_SQUARE_SLEW 0x1000  // 1/16 of a cycle per edge
+
+int16_t sineTable[WAVE_TABLE_LEN + 1];
+int16_t userWave[WAVE_USER_SLOTS][WAVE_USER_LEN + 1];  // the last entry repeats the first one to close the cycle
+
+void waveSetup() {  // sample the waveform. it only needs to run once
+  static bool readyQ = false;
+  if (readyQ) return;
+  for (int i = 0; i <= WAVE_TABLE_LEN; i++)
+    sineTable[i] = int16_t(round(sin(2 * M_PI * i / WAVE_TABLE_LEN) * WAVE_ONE));
+  readyQ = true;
+}
+
+inline int32_t waveSine(uint16_t phase) {  // sin(2 pi phase / 65536) in Q15
+  const int16_t* t = sineTable + (phase >> (WAVE_PHASE_BITS - WAVE_TABLE_BITS));
+  int32_t frac = phase & ((1 << (WAVE_PHASE_BITS - WAVE_TABLE_BITS)) - 1);
+  return t[0] + (((int32_t(t[1]) - t[0]) * frac) >> (WAVE_PHASE_BITS - WAVE_TABLE_BITS));
+}
+
+inline int32_t waveTriangle(uint16_t phase) {  // 0 at phase 0, WAVE_ONE at a quarter, -WAVE_ONE at three quarters
+  int32_t d = int32_t(uint16_t(phase + WAVE_QUARTER)) - 2 * WAVE_QUARTER;  // -half ~ half from the trough
+  int32_t v = WAVE_ONE - 2 * (d < 0 ? -d : d);
+  return v < -WAVE_ONE ? -WAVE_ONE : v;
+}
+
+inline int32_t waveSquare(uint16_t phase) {
+  int32_t v = waveTriangle(phase) * (2 * WAVE_QUARTER) / WAVE_SQUARE_SLEW;
+  return v > WAVE_ONE ? WAVE_ONE : (v < -WAVE_ONE ? -WAVE_ONE : v);
+}
+
+void setUserWave(uint8_t slot, const int8_t* sample) {  // WAVE_USER_LEN samples of one cycle, WAVE_USER_FULL is 1.0
+  int16_t* t = userWave[slot % WAVE_USER_SLOTS];
+  for (int i = 0; i < WAVE_USER_LEN; i++) {
+    int s = sample[i] > WAVE_USER_FULL ? WAVE_USER_FULL : (sample[i] < -WAVE_USER_FULL ? -WAVE_USER_FULL : sample[i]);
+    t[i] = int16_t(int32_t(s) * WAVE_ONE / WAVE_USER_FULL);
+  }
+  t[WAVE_USER_LEN] = t[0];
+}
+
+inline int32_t waveSample(uint8_t shape, uint16_t phase) {  // in Q15
+  switch (shape) {
+    case WAVE_SINE: return waveSine(phase);
+    case WAVE_TRIANGLE: return waveTriangle(phase);
+    case WAVE_SQUARE: return waveSquare(phase);
+    default: {
+      const int16_t* t =
+          userWave[(shape - WAVE_USER) % WAVE_USER_SLOTS] + (phase >> (WAVE_PHASE_BITS - WAVE_USER_BITS));
+      int32_t frac = phase & ((1 << (WAVE_PHASE_BITS - WAVE_USER_BITS)) - 1);
+      return t[0] + (((int32_t(t[1]) - t[0]) * frac) >> (WAVE_PHASE_BITS - WAVE_USER_BITS));
+    }
+  }
+}
+
+#endif
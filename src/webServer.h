@@ -604,6 +604,7 @@ void resetWifiManager() {
 
 // 主循环调用函数
 void WebServerLoop() {
+  PROFILE(PROF_WEB_SERVER);
   if (webServerConnected) {
     webSocket.loop();
 
@@ -0,0 +1,161 @@
+// allocCounter.h: the steady loop of a gait allocates nothing. The loop task is driven through the firmware code: wkF
+// is played from the compressed instincts by SkillFrames and submitted like Skill::performAngles(), motionTick() and
+// servoFrame() (motionOutput.h) send it to a PCA9685 on a mock bus, and the m and i tasks of a q sequence go through
+// the task queue, the joint command parser (jointCommand.h) and transform() like reaction() runs them. ALLOC_CHECK()
+// fails the program on an allocation, so allocFailTest, the same loop with ALLOC_IN_LOOP, must fail
+#define ALLOC_COUNTER
+#define PROFILE_CORE 1
+#include "arduinoStub.h"
+#include "hostTest.h"
+
+int xPortGetCoreID() {
+  return PROFILE_CORE;  // the test runs as the loop task
+}
+
+#include "allocCounter.h"
+#define PCA9685_SERVO
+#define SERVO_FREQ 240  // RoboDog.h
+#include "servoOutput.h"
+#include "dutyTable.h"
+#include "InstinctBittleESPCompressed.h"
+#include "motionEngine.h"
+#include "skillFrames.h"
+
+// RoboDog.h
+#define PWM_NUM 12
+#define HEAD_GROUP_LEN 4
+#define T_SKILL 'k'
+#define T_INDEXED_SIMULTANEOUS_ASC 'i'
+#define T_INDEXED_SEQUENTIAL_ASC 'm'
+#define P1S_RANGE 290  // SERVO_P1S of espServo.h
+char token;
+int cmdLen;
+char newCmd[BUFF_LEN + 1];
+char lastCmd[CMD_LEN + 1];
+byte newCmdIdx;
+byte transformSpeed = 2;
+bool updateGyroQ = true, printGyroQ = false, manualHeadQ = false, nonHeadJointQ = false;
+int targetHead[HEAD_GROUP_LEN];
+int8_t rotationDirection[] = {1, -1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, 1, -1};
+int angleLimit[][2] = {{-120, 120}, {-85, 85}, {-120, 120}, {-120, 120}, {-90, 60},  {-90, 60},
+                       {-90, 90},   {-90, 90}, {-200, 80},  {-200, 80},  {-80, 200}, {-80, 200},
+                       {-80, 200},  {-80, 200}, {-80, 200}, {-80, 200}};
+int currentAng[DOF] = {0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, -55, -55, -55, -55};
+int previousAng[DOF] = {0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, -55, -55, -55, -55};
+int calibratedZeroPosition[DOF];
+void print6Axis() {}
+
+// espServo.h
+typedef DutyTable<P1S_RANGE, SERVO_FREQ, 500, 2500> dutyP1S;
+struct MockBus {
+  long bytes;
+  MockBus() : bytes(0) {}
+  void beginTransmission(uint8_t address) {}
+  size_t write(const uint8_t* b, size_t n) {
+    bytes += n;
+    return n;
+  }
+  uint8_t endTransmission() { return 0; }
+};
+struct NoLock {
+  bool tryLock() { return true; }
+  void unlock() {}
+};
+MockBus bus;
+PCA9685Output<MockBus, NoLock> pcaOutput(bus, 0x40, NULL);
+ServoOutput* servoOut = &pcaOutput;
+ServoTicks servoTicks[PWM_NUM];
+
+#include "motionOutput.h"
+#include "jointCommand.h"
+#include "taskQueue.h"
+
+#define FRAMES 100000
+#define ADVANCE (5.0f / 11)  // frameAdvance at gait rate 1: GAIT_UPDATE_MS / (delayShort + delayMid)
+
+void runJointCmd() {  // the T_INDEXED_SEQUENTIAL_ASC and T_INDEXED_SIMULTANEOUS_ASC branch of reaction()
+  int targetFrame[DOF + 1];
+  for (int i = 0; i < DOF; i++) targetFrame[i] = currentAng[i];
+  targetFrame[DOF] = '~';
+  copyJointCmd(newCmd, cmdLen);
+  char* pch = firstJointPair();
+  nonHeadJointQ = false;
+  do {
+    int target[2] = {};
+    readJointPair(pch, target);
+    setJointTarget(targetFrame, target);
+    if (token == T_INDEXED_SEQUENTIAL_ASC) {
+      transform(targetFrame, 1, 1);
+      delay(10);
+    }
+  } while (pch != NULL);
+  transform(targetFrame, 1, transformSpeed);
+}
+
+int main() {
+  pcaOutput.setPrescale(PCA9685_OSCILLATOR, pca9685Prescale(SERVO_FREQ));
+  for (byte s = 0; s < PWM_NUM; s++) servoTicks[s] = {P1S_RANGE, dutyP1S::tick, pcaOutput.gain(s)};
+  for (int j = 0; j < DOF; j++) calibratedZeroPosition[j] = P1S_RANGE / 2;
+  tQueue = new TaskQueue();
+  SkillFrames* skill = new SkillFrames();
+  ALLOC_CHECK(false);  // the setup may allocate
+
+  // Skill::buildSkill() of wkF
+  const int8_t* wkF = progmemPointer[29];
+  CHECK(!strcmp(skillNameWithType[29], "wkFI"));
+  skill->period = wkF[0];
+  skill->frameSize = WALKING_DOF;
+  skill->angleDataRatio = wkF[3];
+  skill->firstMotionJoint = DOF - WALKING_DOF;
+  skill->setFrames(wkF + 4, true);
+  int frame = 0;
+  float framePhase = 0;
+
+  uint32_t worst = 0;
+  int tasksRun = 0;
+  long moved = 0;
+  for (long f = 0; f < FRAMES; f++) {
+    // Skill::performAngles() of the gait
+    float frameAng[DOF];
+    for (byte j = DOF - WALKING_DOF; j < DOF; j++)
+      frameAng[j] = skill->gaitAngle(j - skill->firstMotionJoint, frame, framePhase);
+    MOTION_LOCK;
+    motionEngine.submit(frameAng + DOF - WALKING_DOF, currentAng, 1, 0, DOF - WALKING_DOF);
+    MOTION_UNLOCK;
+    motionTick();
+    skill->advancePhase(frame, framePhase, ADVANCE);
+#ifdef ALLOC_IN_LOOP
+    if (f == FRAMES / 2) keep(new int);
+#endif
+    // a task sequence every few cycles, loaded by popTask() and run like reaction() does
+    if (f % 1000 == 0) {
+      strcpy(newCmd, "m 8 0 8 -30 12 10:200>i 0 20 9 10:200>");
+      tQueue->createTask();
+    }
+    tQueue->popTask();
+    if (newCmdIdx == 5) {  // a task was loaded
+      long before = bus.bytes;
+      runJointCmd();
+      moved += bus.bytes > before;
+      tasksRun++;
+      newCmdIdx = 0;
+    }
+    delay(10);
+    worst = max(worst, allocCount);
+    ALLOC_CHECK(true);
+  }
+  printf("%d frames of wkF with %d joint commands, %ld bytes to the servos: at most %u allocation(s) per loop\n",
+         FRAMES, tasksRun, bus.bytes, worst);
+  CHECK(tasksRun == FRAMES / 1000 * 2);
+  CHECK(moved == tasksRun);  // the commands did reach the servos
+  CHECK(targetHead[0] == 20 && manualHeadQ);
+  CHECK(worst == 0);
+
+  // the counter does see the allocations of the loop task
+  int* p = new int[DOF];
+  CHECK(allocCount == 1);
+  delete[] p;
+  ALLOC_CHECK(false);
+  delete skill;
+  return testResult();
+}
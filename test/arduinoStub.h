@@ -0,0 +1,62 @@
+/* The definitions of the Arduino core, RoboDog.h and tools.h that the tested headers use, for a host build.
+
+   The prints are dropped. millis() is a simulated clock that only delay() moves.
+*/
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char*)(addr))
+#define F(s) s
+
+#ifndef DOF
+#define DOF 16
+#endif
+#define WALKING_DOF 8
+#define CMD_LEN 20
+#define BUFF_LEN 2507
+
+#define PT(s) (void)(s)
+#define PTL(s) (void)(s)
+#define PTF(s)
+#define PTLF(s)
+#define PTH(head, value) (void)(value)
+#define PTHL(head, value) (void)(value)
+#define PROFILE(stage)
+
+unsigned long hostMillis = 0;
+unsigned long millis() {
+  return hostMillis;
+}
+void delay(unsigned long ms) {
+  hostMillis += ms;
+}
+
+void printToAllPorts(const char* s) {}
+
+template <typename T>
+int strlenUntil(T* s, char terminator) {
+  int l = 0;
+  while (l < BUFF_LEN && s[l] != terminator) { l++; }
+  return l;
+}
+
+template <typename T, typename T1>
+void arrayNCPY(T* destination, const T1* source, int len) {
+  for (int i = 0; i < len; i++) destination[i] = source[i];
+}
+
+template <typename T>
+void printCmdByType(char t, T* data) {}
+
+#endif
@@ -0,0 +1,118 @@
+// The balance adjustment of BalanceGain (balanceGain.h) as updateAdjust() runs it, one pass per IMU sample, against
+// the per joint adjust() it replaced, over roll and pitch sweeps with every balanceSlope, for gaits and postures. Then
+// the time of an update of the walking joints each way
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "balanceGain.h"
+
+// motion.h
+#define panF 60
+#define tiltF 60
+#define sRF 50
+#define sPF 12
+#define uRF 50
+#define uPF 50
+#define lRF (-1.5 * uRF)
+#define lPF (-1.5 * uPF)
+#define LEFT_RIGHT_FACTOR 2
+#define POSTURE_WALKING_FACTOR 0.5
+#define ADJUSTMENT_DAMPER 5
+
+float adaptiveParameterArray[][2] = {{-panF / 2, 0}, {panF / 8, -tiltF / 3}, {0, 0}, {-1 * panF, 0},
+                                     {sRF, -sPF}, {-sRF, -sPF}, {-sRF, sPF}, {sRF, sPF},
+                                     {uRF, uPF}, {uRF, uPF}, {uRF, uPF}, {uRF, uPF},
+                                     {lRF, -0.5 * lPF}, {lRF, -0.5 * lPF}, {lRF, 0.5 * lPF}, {lRF, 0.5 * lPF}};
+float radPerDeg = M_PI / 180;
+float RollPitchDeviation[2];
+int balanceSlope[2] = {1, 1};
+float oldAdjust[DOF];
+
+// adjust() of motion.h before the gain matrix, one joint per call
+float adjust(byte i, bool postureQ = false) {
+  float rollAdj, pitchAdj;
+  float cutOff = postureQ ? 45 : 15;
+  pitchAdj = adaptiveParameterArray[i][1] * max(-cutOff, min(cutOff, RollPitchDeviation[1]));
+  if (i == 1 || i > 3) {
+    bool leftQ = (i - 1) % 4 > 1 ? true : false;
+    float leftRightFactor = 1;
+    if ((leftQ && balanceSlope[0] * RollPitchDeviation[0] > 0) ||
+        (!leftQ && balanceSlope[0] * RollPitchDeviation[0] < 0))
+      leftRightFactor = LEFT_RIGHT_FACTOR * abs(balanceSlope[0]);
+    rollAdj = (i == 1 || i > 7 ? fabs(RollPitchDeviation[0]) : RollPitchDeviation[0]) * adaptiveParameterArray[i][0] *
+              leftRightFactor;
+  } else
+    rollAdj = RollPitchDeviation[0] * adaptiveParameterArray[i][0];
+  float idealAdjust =
+      radPerDeg * ((i > 3 ? POSTURE_WALKING_FACTOR : 1) * balanceSlope[0] * rollAdj - balanceSlope[1] * pitchAdj);
+  oldAdjust[i] += max(min(idealAdjust - oldAdjust[i], float(ADJUSTMENT_DAMPER)), -float(ADJUSTMENT_DAMPER));
+  int thres = (i > 3 && i % 4 < 2) ? 15 : 45;
+  oldAdjust[i] = max(float(-45), min(float(thres), oldAdjust[i]));
+  return oldAdjust[i];
+}
+
+int main() {
+  BalanceGain gain;
+  float adjustBuffer[2][DOF];
+  const int slopes[][2] = {{1, 1}, {-1, 1}, {1, -1}, {-1, -1}, {2, 1}};
+  float worst = 0, largest = 0;
+  long samples = 0;
+  for (int s = 0; s < 5; s++)
+    for (int postureQ = 0; postureQ < 2; postureQ++) {
+      balanceSlope[0] = slopes[s][0];
+      balanceSlope[1] = slopes[s][1];
+      gain.setup(adaptiveParameterArray, balanceSlope, LEFT_RIGHT_FACTOR, POSTURE_WALKING_FACTOR);
+      byte first = postureQ ? 0 : DOF - WALKING_DOF;
+      float* current = adjustBuffer[0];
+      for (int i = 0; i < DOF; i++) current[i] = oldAdjust[i] = 0;
+      // the roll sweeps at every pitch and the pitch sweeps at every roll, each way, so the slew limit and the
+      // clamps are crossed from both sides
+      for (int axis = 0; axis < 2; axis++)
+        for (int outer = -60; outer <= 60; outer += 5)
+          for (int inner = -600; inner <= 600; inner++, samples++) {
+            float sweep = (inner < 0 ? -inner - 300 : inner - 300) / 5.0f;  // -60 ~ 60 and back
+            RollPitchDeviation[axis] = sweep;
+            RollPitchDeviation[!axis] = outer;
+            for (byte i = first; i < DOF; i++) adjust(i, postureQ);
+            float* next = adjustBuffer[current == adjustBuffer[0]];
+            gain.step(current, next, RollPitchDeviation[0], RollPitchDeviation[1], postureQ ? 45 : 15,
+                      ADJUSTMENT_DAMPER, first);
+            current = next;
+            for (int i = 0; i < DOF; i++) {
+              worst = std::max(worst, float(fabs(current[i] - oldAdjust[i])));
+              largest = std::max(largest, float(fabs(current[i])));
+            }
+          }
+    }
+
+  // an update of the walking joints during a gait, each way
+  balanceSlope[0] = balanceSlope[1] = 1;
+  gain.setup(adaptiveParameterArray, balanceSlope, LEFT_RIGHT_FACTOR, POSTURE_WALKING_FACTOR);
+  const int updates = 1000000;
+  float sum = 0;
+  double start = nowNs();
+  for (int u = 0; u < updates; u++) {
+    RollPitchDeviation[0] = (u % 97) - 48;
+    RollPitchDeviation[1] = (u % 89) - 44;
+    for (byte i = DOF - WALKING_DOF; i < DOF; i++) sum += adjust(i);
+  }
+  double adjustNs = (nowNs() - start) / updates;
+  float* current = adjustBuffer[0];
+  start = nowNs();
+  for (int u = 0; u < updates; u++) {
+    float* next = adjustBuffer[current == adjustBuffer[0]];
+    gain.step(current, next, (u % 97) - 48, (u % 89) - 44, 15, ADJUSTMENT_DAMPER, DOF - WALKING_DOF);
+    current = next;
+    sum += current[DOF - 1];
+  }
+  double stepNs = (nowNs() - start) / updates;
+  keep(sum);
+  printf("%ld samples over the roll and pitch sweeps: the largest adjustment %.1f degrees, the worst difference from "
+         "adjust() %.2g degrees\n",
+         samples, largest, worst);
+  printf("an update of the walking joints: %.0f ns in %d adjust() calls, %.0f ns in one step()\n", adjustNs,
+         WALKING_DOF, stepNs);
+  CHECK(largest > 40);  // the sweeps reach the clamps
+  CHECK(worst < 1e-3);
+  return testResult();
+}
@@ -0,0 +1,87 @@
+// BalanceAxis (balancePD.h) against the P balance on a simulated body: an inverted pendulum on springy legs, 10 cm
+// high, that sways at 4 Hz with a damping ratio of 0.15, behind a 30 ms servo lag. The IMU angle is 4 samples late
+// (the ypr filter), the gyro rate is not. A 10 degree slope comes under the feet at t = 0. The P balance feeds the sway
+// instead of damping it, so it grows until the body would fall. The PD balance with the defaults of motion.h settles
+// on the slope, and its integral term removes the tilt the slope leaves
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "balancePD.h"
+
+#define CONTROL_FREQ 200  // RoboDog.h
+#define ADJUSTMENT_DAMPER 5
+#define BALANCE_PD_DAMPER 15  // motion.h
+#define SLOPE 10              // degrees
+#define FILTER_DELAY 4        // IMU samples
+#define SERVO_LAG 0.03        // s
+#define SIM_STEP 1e-4         // s
+#define SIM_TIME 10           // s
+
+struct Response {
+  double peak;       // the largest tilt, when the slope comes
+  double overshoot;  // the largest tilt the other way, once the balance corrected it
+  double settle;     // the time after which the tilt stays within 1 degree
+  double swing;      // peak to peak over the last 2 s
+  double tilt;       // at the end
+};
+
+// pdQ: BALANCE_PD with kp, kd (s) and ki (1/s). otherwise BALANCE_P: the correction is the deviation
+Response simulate(bool pdQ, float kp = 1, float kd = 0, float ki = 0) {
+  BalanceAxis axis;
+  axis.setGains(kp, kd, ki);
+  const double wn = 2 * M_PI * 4, zeta = 0.15, gravity = 9.81 / 0.1;  // 1/s^2 per radian of a 10 cm pendulum
+  const double legs = wn * wn + gravity;  // the stiffness of the legs leaves a 4 Hz sway
+  const float damper = pdQ ? BALANCE_PD_DAMPER : ADJUSTMENT_DAMPER;
+  const int controlSteps = int(1.0 / CONTROL_FREQ / SIM_STEP + 0.5);
+  double tilt = 0, rate = 0, servo = 0;  // degrees, degrees/s and degrees
+  float adjust = 0;
+  double filter[FILTER_DELAY + 1] = {};
+  double lateMin = 1e9, lateMax = -1e9;
+  Response r = {0, 0, 0, 0, 0};
+  bool correctedQ = false;
+  for (long i = 0; i < long(SIM_TIME / SIM_STEP); i++) {
+    double t = i * SIM_STEP;
+    if (i % controlSteps == 0) {  // an IMU sample and updateAdjust()
+      for (int k = FILTER_DELAY; k > 0; k--) filter[k] = filter[k - 1];
+      filter[0] = tilt;
+      float deviation = filter[FILTER_DELAY];
+      float ideal = pdQ ? axis.update(deviation, rate, 1.0 / CONTROL_FREQ, 45) : deviation;
+      adjust += std::max(-damper, std::min(damper, ideal - adjust));  // BalanceGain::step()
+      adjust = std::max(-45.0f, std::min(45.0f, adjust));
+    }
+    servo += (adjust - servo) / SERVO_LAG * SIM_STEP;
+    double accel = gravity * tilt - legs * (tilt - SLOPE + servo) - 2 * zeta * wn * rate;
+    rate += accel * SIM_STEP;
+    tilt += rate * SIM_STEP;
+    r.peak = std::max(r.peak, tilt);
+    correctedQ |= tilt < 0;
+    if (correctedQ) r.overshoot = std::max(r.overshoot, -tilt);
+    if (fabs(tilt) > 1) r.settle = t;
+    if (t > SIM_TIME - 2) {
+      lateMin = std::min(lateMin, tilt);
+      lateMax = std::max(lateMax, tilt);
+    }
+  }
+  r.swing = lateMax - lateMin;
+  r.tilt = tilt;
+  return r;
+}
+
+int main() {
+  Response p = simulate(false);
+  Response pd = simulate(true, 1, 0.03, 2);  // balancePD of motion.h: kp 100/100, kd 30 ms, ki 200/100 per s
+  Response pdNoI = simulate(true, 1, 0.03, 0);
+  const char* names[] = {"P", "PD", "PD, ki 0"};
+  Response* all[] = {&p, &pd, &pdNoI};
+  for (int m = 0; m < 3; m++)
+    printf("%-8s peak %5.1f, overshoot %5.1f, within 1 degree after %5.2f s, swing over the last 2 s %5.1f, end tilt "
+           "%5.2f degrees\n",
+           names[m], all[m]->peak, all[m]->overshoot, all[m]->settle, all[m]->swing, all[m]->tilt);
+  CHECK(p.swing > 45);  // it diverges
+  CHECK(pd.settle < 4);
+  CHECK(pd.peak < SLOPE * 1.2);
+  CHECK(pd.overshoot < 3);
+  CHECK(fabs(pd.tilt) < 0.1 && pd.swing < 0.5);
+  CHECK(fabs(pdNoI.tilt) > 1);  // without the integral, the slope leaves a tilt
+  return testResult();
+}
@@ -0,0 +1,110 @@
+// The crossfade between two compressed gaits (SkillFrames::startBlend() of skillFrames.h) made the way
+// loadBySkillName() makes it: the running gait is copied into previousGait, the next gait is loaded into the same
+// object and continues at the same normalized phase. Every output of every pair of instinct gaits is checked against
+// the same crossfade over the raw frames, and the joint velocity during the blend is bounded by the velocities of the
+// two gaits plus the easing of the gap between them
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "skillFrames.h"
+
+namespace raw {
+#include "InstinctBittleESP.h"
+}
+namespace encoded {
+#include "InstinctBittleESPCompressed.h"
+}
+
+#define SKILL_NUM (sizeof(raw::progmemPointer) / sizeof(raw::progmemPointer[0]))
+#define BLEND_FRAMES 8       // gaitBlendFrames of RoboDog.h
+#define ADVANCE (5.0f / 11)  // frameAdvance at gait rate 1: GAIT_UPDATE_MS / (delayShort + delayMid)
+#define STARTS 4             // switching points per pair
+
+void loadGait(SkillFrames& g, const int8_t* data, bool encoded) {  // Skill::buildSkill() of a gait
+  g.period = data[0];
+  g.frameSize = WALKING_DOF;
+  g.angleDataRatio = data[3];
+  g.firstMotionJoint = DOF - WALKING_DOF;
+  g.resetColumns();
+  g.blendFrom = NULL;
+  g.setFrames(data + 4, encoded);
+}
+
+float maxStep(const int8_t* data) {  // the largest change of a joint between two frames of a gait, in degrees
+  int period = data[0], worst = 0;
+  for (int k = 0; k < period; k++)
+    for (int c = 0; c < WALKING_DOF; c++)
+      worst = std::max(worst, abs(data[4 + (k + 1) % period * WALKING_DOF + c] - data[4 + k * WALKING_DOF + c]));
+  return worst * data[3];
+}
+
+int main() {
+  easingSetup();
+  srand(10);
+  int gaits[SKILL_NUM], gaitNum = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++)
+    if (raw::progmemPointer[s][0] > 1) gaits[gaitNum++] = s;
+
+  SkillFrames skill, previousGait, rawSkill, rawPrevious;
+  long blends = 0, outputs = 0, mismatches = 0, overBound = 0;
+  float worstBlend = 0, worstGait = 0, worstRatio = 0;
+  for (int ia = 0; ia < gaitNum; ia++)
+    for (int ib = 0; ib < gaitNum; ib++) {
+      if (ia == ib) continue;
+      const int8_t *rawA = raw::progmemPointer[gaits[ia]], *rawB = raw::progmemPointer[gaits[ib]];
+      float vFrom = maxStep(rawA) * rawA[0] / rawB[0];  // per frame of the new gait
+      float vTo = maxStep(rawB);
+      worstGait = std::max(worstGait, std::max(maxStep(rawA), vTo));
+      for (int start = 0; start < STARTS; start++, blends++) {
+        loadGait(skill, encoded::progmemPointer[gaits[ia]], true);
+        loadGait(rawSkill, rawA, false);
+        int frame = 0, rawFrame = 0;
+        float framePhase = 0, rawPhase = 0;
+        int ticks = rand() % int(2 * rawA[0] / ADVANCE);
+        for (int t = 0; t < ticks; t++) {  // the first gait plays for a while
+          skill.gaitAngle(0, frame, framePhase);  // the decoder reads the frames as the playback goes
+          skill.advancePhase(frame, framePhase, ADVANCE);
+          rawSkill.advancePhase(rawFrame, rawPhase, ADVANCE);
+        }
+        float last[WALKING_DOF];
+        for (int c = 0; c < WALKING_DOF; c++) last[c] = skill.gaitAngle(c, frame, framePhase);
+
+        // loadBySkillName()
+        previousGait = skill;
+        previousGait.blendFrom = NULL;
+        loadGait(skill, encoded::progmemPointer[gaits[ib]], true);
+        skill.startBlend(&previousGait, BLEND_FRAMES, frame, framePhase);
+        rawPrevious = rawSkill;
+        loadGait(rawSkill, rawB, false);
+        rawSkill.startBlend(&rawPrevious, BLEND_FRAMES, rawFrame, rawPhase);
+
+        float worst = 0, gap = 0;
+        for (int t = 0; skill.blendFrom || t < 4; t++, outputs++) {
+          skill.advancePhase(frame, framePhase, ADVANCE);
+          rawSkill.advancePhase(rawFrame, rawPhase, ADVANCE);
+          for (int c = 0; c < WALKING_DOF; c++) {
+            float a = skill.gaitAngle(c, frame, framePhase);
+            mismatches += a != rawSkill.gaitAngle(c, rawFrame, rawPhase);
+            if (skill.blendFrom)
+              gap = std::max(gap, float(fabs(skill.angleAt(frame + framePhase, c) -
+                                             previousGait.angleAt((frame + framePhase) * rawA[0] / rawB[0], c))));
+            worst = std::max(worst, float(fabs(a - last[c]) / ADVANCE));
+            last[c] = a;
+          }
+        }
+        // d/dp (from + (to - from) w) is within max(|from'|, |to'|) + |to - from| w', and w' of the cosine easing over
+        // BLEND_FRAMES frames is at most pi / 2 / BLEND_FRAMES
+        float bound = std::max(vFrom, vTo) + gap * M_PI / 2 / BLEND_FRAMES + 1;
+        overBound += worst > bound;
+        worstBlend = std::max(worstBlend, worst);
+        worstRatio = std::max(worstRatio, worst / bound);
+      }
+    }
+  printf("%d gaits, %ld crossfades, %ld outputs: %ld differ from the raw frames. the fastest joint moves %.1f degrees "
+         "per frame in a blend, %.1f in a gait. worst blend at %.2f of its bound\n",
+         gaitNum, blends, outputs, mismatches, worstBlend, worstGait, worstRatio);
+  CHECK(gaitNum > 20);
+  CHECK(mismatches == 0);
+  CHECK(overBound == 0);
+  return testResult();
+}
@@ -0,0 +1,64 @@
+// ControlClock (controlClock.h) driven by a simulated clock: the grid stays fixed through jitter, late wake-ups and
+// overruns, and the counters report them
+#include "controlClock.h"
+#include "hostTest.h"
+
+#define PERIOD 5000  // us. 200 Hz, CONTROL_FREQ of RoboDog.h
+
+int main() {
+  ControlClock clock;
+  clock.begin(PERIOD, PERIOD);
+  srand(1);
+
+  // wake-ups up to 300 us late, 400 us of work
+  uint32_t worst = 0;
+  uint64_t sum = 0;
+  for (int i = 0; i < 10000; i++) {
+    int64_t grid = int64_t(i + 1) * PERIOD;
+    uint32_t late = rand() % 300;
+    clock.start(grid + late);
+    clock.finish(grid + late + 400);
+    if (late > worst) worst = late;
+    sum += late;
+    CHECK(clock.next == grid + PERIOD);  // the grid doesn't drift with the jitter
+  }
+  printf("10000 ticks: jitter avg %u max %u us, exec max %u us, missed %u\n", clock.jitterAvg(), clock.jitterMax,
+         clock.execMax, clock.missed);
+  CHECK(clock.ticks == 10000);
+  CHECK(clock.missed == 0);
+  CHECK(clock.jitterMax == worst);
+  CHECK(clock.jitterAvg() == sum / 10000);
+  CHECK(clock.execMax == 400);
+
+  // a tick whose work runs past the next tick is a missed deadline
+  clock.reset();
+  int64_t grid = clock.next;
+  clock.start(grid);
+  clock.finish(grid + PERIOD + 1);
+  CHECK(clock.missed == 1);
+
+  // waking up 2.5 periods late skips two ticks, and the grid moves to the tick that is running
+  clock.reset();
+  grid = clock.next;
+  clock.start(grid + 2 * PERIOD + PERIOD / 2);
+  CHECK(clock.missed == 2);
+  CHECK(clock.jitterMax == PERIOD / 2);
+  CHECK(clock.next == grid + 3 * PERIOD);
+  clock.finish(grid + 2 * PERIOD + PERIOD / 2 + 100);
+  CHECK(clock.missed == 2);
+
+  // an early wake-up counts as jitter too, and the next tick is still on the grid
+  clock.reset();
+  grid = clock.next;
+  clock.start(grid - 50);
+  CHECK(clock.jitterMax == 50);
+  CHECK(clock.next == grid + PERIOD);
+
+  // the grid stays exact over 5000 s of ticks
+  clock.begin(PERIOD, PERIOD);
+  for (int i = 0; i < 1000000; i++) clock.start(int64_t(i + 1) * PERIOD + (i % 7) * 30);
+  CHECK(clock.ticks == 1000000);
+  CHECK(clock.missed == 0);
+  CHECK(clock.next == int64_t(1000001) * PERIOD);
+  return testResult();
+}
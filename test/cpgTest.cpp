@@ -0,0 +1,225 @@
+// CPG (cpg.h) across parameter changes in the middle of a cycle: the rg presets of updateCPG() one after another,
+// faster and slower tick rates (loopDelay), and a new sample count. The phase of each leg moves no more at a change
+// than the new parameters move it in a tick, plus the slew of the offsets. Then the cost of a tick, of a sample of the
+// wave table (waveTable.h) against sinf(), and of a switch between the presets against the CPG that was rebuilt with
+// new and delete, and the memory of both
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "waveTable.h"
+#define GAIT_UPDATE_MS 5  // RoboDog.h
+#include "cpg.h"
+
+// the rg presets of updateCPG() in motion.h: amplitude, side ratio, state switch angle, 2 shifts, loop delay, 2 skip
+// steps and 4 phases
+int8_t presets[][12] = {{20, 0, 5, -8, 4, 3, 1, 2, 35, 1, 35, 1},     {35, 0, 5, -8, 4, 3, 1, 2, 35, 1, 35, 1},
+                        {15, 0, 5, -6, -4, 3, 1, 3, 21, 51, 31, 1},   {15, 0, 5, -14, -10, 1, 2, 1, 70, 70, 1, 1},
+                        {18, 0, 5, -6, -10, 3, 3, 1, 80, 80, 1, 1},   {17, 0, 5, 0, 0, 3, 1, 3, 1, 75, 50, 25},
+                        {18, 0, 5, -4, -4, 3, 2, 3, 36, 49, 49, 36}, {18, 0, 5, 0, 0, 3, 1, 2, 35, 46, 35, 46}};
+#define PRESETS 8
+
+// the CPG of motion.h before the wave table: the tables of the samples are computed in the constructor and setPar(),
+// and updateCPG() deleted and rebuilt it when the skip steps changed. the prints to Serial are left out
+class OldCPG {
+  int _nSample;
+  float* precalcCos;
+  int* pick;
+  float* sample;
+  bool* supportStage;
+  int shiftIndex[5];
+  int edge;
+  int8_t _amplitude, _sideRatio, _stateSwitchAngle, _loopDelay;
+  int8_t _phase[5];
+
+ public:
+  int sampleLen;
+  int8_t _midShift[2];
+  int8_t _skipStep[2];
+  OldCPG(int nSample, int8_t skipStep[]) {
+    _nSample = nSample;
+    precalcCos = new float[_nSample + 1];
+    pick = new int[_nSample + 1];
+    sample = nullptr;
+    supportStage = nullptr;
+    _phase[4] = 0;
+    sampleLen = 0;
+    _skipStep[0] = skipStep[0];
+    _skipStep[1] = skipStep[1];
+    edge = _nSample * 0.05;
+    float step = 1;
+    int pickIndex = 0;
+    for (int i = 0; i < _nSample; i++) {
+      precalcCos[i] = -cos(i * 2 * 3.14159 / _nSample);
+      pick[i] = -1;
+      if (i > edge && i < _nSample / 2 - edge)
+        step = _skipStep[0];
+      else
+        step = _skipStep[1];
+      if (i == pickIndex) {
+        pick[i] = sampleLen;
+        pickIndex += step;
+        sampleLen++;
+      }
+    }
+  }
+  ~OldCPG() {
+    delete[] precalcCos;
+    delete[] pick;
+    if (sample != nullptr) delete[] sample;
+    if (supportStage != nullptr) delete[] supportStage;
+  }
+  void setPar(int8_t amplitude, int8_t sideRatio, int8_t stateSwitchAngle, int8_t loopDelay, int8_t midShift[],
+              int8_t phase[]) {
+    _amplitude = amplitude;
+    _sideRatio = sideRatio;
+    _stateSwitchAngle = stateSwitchAngle;
+    _loopDelay = loopDelay;
+    _midShift[0] = midShift[0];
+    _midShift[1] = midShift[1];
+    for (byte i = 0; i < 4; i++) _phase[i] = phase[i];
+    if (sample != nullptr) delete[] sample;
+    if (supportStage != nullptr) delete[] supportStage;
+    sample = new float[sampleLen];
+    supportStage = new bool[sampleLen];
+    sampleLen = 0;
+    for (int8_t l = 0; l < 5; l++) {
+      shiftIndex[l] = _phase[l] / 100.0 * _nSample;
+      for (int i = 0; i < _nSample; i++) {
+        int j = (shiftIndex[l] + i) % _nSample;
+        if (pick[j] >= 0) {
+          if (l == 4) {
+            sample[sampleLen] = precalcCos[j];
+            supportStage[sampleLen] = (i > edge && i < _nSample / 2 - edge);
+            sampleLen++;
+          } else {
+            shiftIndex[l] = pick[j];
+            break;
+          }
+        }
+      }
+    }
+  }
+  float first() { return sample[0]; }
+  size_t bytes() {  // with the arrays on the heap
+    return sizeof(*this) + (_nSample + 1) * (sizeof(float) + sizeof(int)) + sampleLen * (sizeof(float) + sizeof(bool));
+  }
+};
+
+float phaseStep(float from, float to) {  // the shorter way around the cycle
+  float d = fabs(to - from);
+  return d > 0.5 ? 1 - d : d;
+}
+
+// the furthest a leg can move in a tick, in cycles: the time advances by a tick of loopDelay ms, and the offset by
+// CPG_OFFSET_SLEW of it, at the longer skip step
+float tickBound(int nSample, const int8_t* skip, int8_t loopDelay) {
+  float advance = float(GAIT_UPDATE_MS) / std::max(int8_t(1), loopDelay);
+  return advance * (1 + CPG_OFFSET_SLEW) * std::max(skip[0], skip[1]) / nSample;
+}
+
+int main() {
+  srand(14);
+  int8_t skip[] = {1, 3};
+  CPG cpg(300, skip);
+  float out[DOF], last[4];
+  bool activeQ[DOF] = {};
+  int nSample = 300;
+  int8_t* p = presets[0];
+  int8_t loopDelay = p[5];
+  cpg.setSteps(nSample, p + 6);
+  cpg.setPar(p[0], p[1], p[2], loopDelay, p + 3, p + 8);
+  for (int l = 0; l < 4; l++) last[l] = cpg.legPhase(l);
+  float worstTick = 0, worstChange = 0, worstRatio = 0;
+  int changes = 0;
+  const int ticks = 200000;
+  for (int tick = 0; tick < ticks; tick++) {
+    bool changeQ = rand() % 150 == 0;
+    if (changeQ) {  // the next preset, sometimes at another rate or sample count, as the r and Q commands set them
+      p = presets[++changes % PRESETS];
+      loopDelay = rand() % 3 ? p[5] : 1 + rand() % 8;
+      int n = rand() % 4 ? 300 : 600;
+      if (n != nSample || p[6] != cpg._skipStep[0] || p[7] != cpg._skipStep[1]) {
+        nSample = n;
+        cpg.setSteps(nSample, p + 6);
+      }
+      cpg.setPar(p[0], p[1], p[2], loopDelay, p + 3, p + 8);
+    }
+    cpg.tick(out, activeQ);
+    float bound = tickBound(nSample, cpg._skipStep, loopDelay);
+    for (int l = 0; l < 4; l++) {
+      float phase = cpg.legPhase(l), d = phaseStep(last[l], phase);
+      last[l] = phase;
+      if (changeQ)
+        worstChange = std::max(worstChange, d);
+      else
+        worstTick = std::max(worstTick, d);
+      worstRatio = std::max(worstRatio, d / bound);
+    }
+  }
+  for (int l = 0; l < 4; l++) CHECK(activeQ[8 + l]);
+
+  // the cost of a tick, and of a sample of the wave table
+  const int rounds = 1000000;
+  float sum = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    cpg.tick(out, activeQ);
+    sum += out[8];
+  }
+  double tickNs = (nowNs() - start) / rounds;
+  int32_t waveSum = 0;
+  start = nowNs();
+  for (int r = 0; r < rounds; r++) waveSum += waveSine(uint16_t(r * 40503u + waveSum));
+  double waveNs = (nowNs() - start) / rounds;
+  start = nowNs();
+  for (int r = 0; r < rounds; r++) sum += sinf(float(uint16_t(r * 40503u + int(sum))) * float(2 * M_PI / 65536));
+  double sinNs = (nowNs() - start) / rounds;
+  keep(sum);
+  keep(waveSum);
+
+  // a switch to the next preset as updateCPG() makes it, each way
+  const int switches = 100000;
+  start = nowNs();
+  for (int r = 0; r < switches; r++) {
+    int8_t* q = presets[r % PRESETS];
+    if (q[6] != cpg._skipStep[0] || q[7] != cpg._skipStep[1]) cpg.setSteps(300, q + 6);
+    cpg.setPar(q[0], q[1], q[2], q[5], q + 3, q + 8);
+    sum += cpg.legPhase(r % 4);
+  }
+  double switchNs = (nowNs() - start) / switches;
+  OldCPG* old = NULL;
+  size_t oldBytes = 0;
+  start = nowNs();
+  for (int r = 0; r < switches / 10; r++) {
+    int8_t* q = presets[r % PRESETS];
+    if (old == NULL || q[6] != old->_skipStep[0] || q[7] != old->_skipStep[1]) {
+      delete old;
+      old = new OldCPG(300, q + 6);
+    }
+    old->setPar(q[0], q[1], q[2], q[5], q + 3, q + 8);
+    sum += old->first();
+    oldBytes = std::max(oldBytes, old->bytes());
+  }
+  double oldSwitchNs = (nowNs() - start) / (switches / 10);
+  delete old;
+  keep(sum);
+  size_t newBytes = sizeof(CPG) + sizeof(sineTable);
+  double worstWave = 0;
+  for (int phase = 0; phase < 65536; phase++)
+    worstWave = std::max(worstWave, fabs(waveSine(phase) / double(WAVE_ONE) - sin(2 * M_PI * phase / 65536)));
+
+  printf("%d parameter changes over %d ticks: a leg moves up to %.4f cycle at a change, %.4f in a tick, %.2f of the "
+         "bound of the running parameters\n",
+         changes, ticks, worstChange, worstTick, worstRatio);
+  printf("a CPG tick: %.1f ns. a wave table sample: %.1f ns (error %.1g) against %.1f ns for sinf()\n", tickNs, waveNs,
+         worstWave, sinNs);
+  printf("a switch between the presets: %.0f ns, the old CPG took %.0f ns. memory: %d bytes with the shared table, "
+         "the old CPG up to %d\n",
+         switchNs, oldSwitchNs, int(newBytes), int(oldBytes));
+  CHECK(changes > 1000);
+  CHECK(switchNs * 10 < oldSwitchNs);
+  CHECK(newBytes * 4 <= oldBytes);
+  CHECK(worstRatio <= 1.001);
+  CHECK(worstWave < 2e-4);  // the interpolation between 256 samples, and Q15
+  return testResult();
+}
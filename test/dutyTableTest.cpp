@@ -0,0 +1,85 @@
+// DutyTable (dutyTable.h) of every servo model of espServo.h against the float path of Servo::write(): map() to an
+// integer pulse width, then Servo::usToTicks(), or the pulse length of Adafruit_PWMServoDriver::writeMicroseconds()
+// in the PCA9685 build (pca9685DutyTableTest, the same source with PCA9685_SERVO). Every entry is checked, the odd
+// half degrees at their fractional width, and a lookup is timed against map() and the float conversion
+#include "hostTest.h"
+#define DEFAULT_TIMER_WIDTH 16  // ESP32Servo.h
+#define REFRESH_USEC 20000
+#define SERVO_FREQ 240  // RoboDog.h
+#include "servoOutput.h"
+#include "dutyTable.h"
+
+#define SERVO_G41 180, SERVO_FREQ, 500, 2500  // espServo.h
+#define SERVO_P1S 290, SERVO_FREQ, 500, 2500
+#define SERVO_P1L 270, SERVO_FREQ, 500, 2500
+#define SERVO_P50 120, SERVO_FREQ, 900, 2100
+
+long arduinoMap(long x, long inMin, long inMax, long outMin, long outMax) {  // map() of Arduino.h
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+#ifdef PCA9685_SERVO
+int floatTicks(float us, int freq) {  // Adafruit_PWMServoDriver::writeMicroseconds()
+  double pulseLength = 1000000.0 * (pca9685Prescale(freq) + 1) / PCA9685_OSCILLATOR;
+  return uint16_t(us / pulseLength);
+}
+#else
+int floatTicks(float us, int freq) {  // Servo::usToTicks()
+  return (int)((float)us / ((float)REFRESH_USEC / (float)(1 << DEFAULT_TIMER_WIDTH)) * (((float)freq) / 50.0));
+}
+#endif
+
+float halfDegreeUs(int h, int range, int minUs, int maxUs) {
+  if (h % 2 == 0) return arduinoMap(h / 2, 0, range, minUs, maxUs);
+  return minUs + h / 2.0f * (maxUs - minUs) / range;
+}
+
+// the worst difference in ticks over the table of a model
+template <int RANGE, int FREQ, int MIN_US, int MAX_US>
+int worstEntry(const char* name) {
+  const uint16_t* tick = DutyTable<RANGE, FREQ, MIN_US, MAX_US>::tick;
+  CHECK(sizeof(DutyTable<RANGE, FREQ, MIN_US, MAX_US>::tick) == (2 * RANGE + 1) * sizeof(uint16_t));
+  int worst = 0;
+  for (int h = 0; h <= 2 * RANGE; h++) {
+    int diff = abs(tick[h] - floatTicks(halfDegreeUs(h, RANGE, MIN_US, MAX_US), FREQ));
+    worst = diff > worst ? diff : worst;
+    if (h > 0) CHECK(tick[h] >= tick[h - 1]);
+  }
+  printf("%s: %d entries, %d to %d ticks, worst difference %d tick\n", name, 2 * RANGE + 1, tick[0], tick[2 * RANGE],
+         worst);
+  return worst;
+}
+
+#define ANGLES 4096  // a power of 2
+
+int main() {
+  CHECK(worstEntry<SERVO_G41>("G41") <= 1);
+  CHECK(worstEntry<SERVO_P1S>("P1S") <= 1);
+  CHECK(worstEntry<SERVO_P1L>("P1L") <= 1);
+  CHECK(worstEntry<SERVO_P50>("P50") <= 1);
+
+  // random integer angles of a P1L servo, converted one at a time like the writes of the servos: each angle depends on
+  // the last ticks, so the host can't vectorize the float path, which the ESP32 can't either
+  const int range = 270;
+  ServoTicks p1l = {range, DutyTable<SERVO_P1L>::tick, 0};
+  int angle[ANGLES];
+  srand(24);
+  for (int i = 0; i < ANGLES; i++) angle[i] = rand() % (range + 1);
+  const int rounds = 2000;
+  long sum = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++)
+    for (int i = 0; i < ANGLES; i++)
+      sum += floatTicks(arduinoMap(angle[(i + sum) & (ANGLES - 1)], 0, range, 500, 2500), SERVO_FREQ);
+  double floatNs = (nowNs() - start) / rounds / ANGLES;
+  keep(sum);
+  long tableSum = 0;
+  start = nowNs();
+  for (int r = 0; r < rounds; r++)
+    for (int i = 0; i < ANGLES; i++) tableSum += tableTicks(p1l, 2 * angle[(i + tableSum) & (ANGLES - 1)]);
+  double tableNs = (nowNs() - start) / rounds / ANGLES;
+  keep(tableSum);
+  CHECK(sum == tableSum);
+  printf("P1L angle to ticks: %.2f ns with map() and the float conversion, %.2f ns with the table\n", floatNs, tableNs);
+  return testResult();
+}
@@ -0,0 +1,81 @@
+// easing.h: the eased trajectories of the motion engine against the double-precision cosine of the old transform(),
+// the tables against their curves, and the cost of a step on both paths
+#define DOF 16
+#include <math.h>
+#include "hostTest.h"
+#include "motionEngine.h"
+
+// the step s of the old transform(): target + (1 + cos(pi s / steps)) / 2 * (current - target)
+float oldStep(int target, int current, int s, int steps) {
+  return target + (steps == 0 ? 0 : (1 + cos(M_PI * s / steps)) / 2 * (current - target));
+}
+
+int main() {
+  easingSetup();
+  srand(4);
+
+  // 2000 random transitions of all the joints at the speed ratios the skills use
+  MotionEngine engine;
+  float worst = 0;
+  long stepsChecked = 0;
+  for (int t = 0; t < 2000; t++) {
+    int current[DOF];
+    int8_t target[DOF];
+    for (int i = 0; i < DOF; i++) {
+      current[i] = rand() % 181 - 90;
+      target[i] = rand() % 181 - 90;
+    }
+    float speedRatio = (rand() % 4 + 1) / 2.0;
+    engine.submit(target, current, 1, speedRatio);
+    float dutyAng[DOF] = {};
+    for (unsigned long now = 0; !engine.idle(); now += engine.stepInterval) {
+      int s = engine.step;
+      CHECK(engine.advance(now, dutyAng));
+      for (int i = 0; i < DOF; i++) {
+        float err = fabs(dutyAng[i] - oldStep(target[i], current[i], s, engine.steps));
+        if (err > worst) worst = err;
+      }
+      stepsChecked++;
+    }
+    for (int i = 0; i < DOF; i++) CHECK(dutyAng[i] == target[i]);
+  }
+  printf("%ld steps of 16 joints: worst difference from the old cosine path %.3f degree\n", stepsChecked, worst);
+  CHECK(worst < 0.5);
+
+  // every table follows its curve, from 0 to EASE_ONE
+  for (int p = 0; p < EASE_PROFILE_NUM; p++) {
+    double worstCurve = 0;
+    int32_t last = 0;
+    for (uint32_t phase = 0; phase <= EASE_PHASE_ONE; phase += 997) {
+      double x = double(phase) / EASE_PHASE_ONE;
+      double curve[EASE_PROFILE_NUM] = {(1 - cos(M_PI * x)) / 2, x, x * x * (3 - 2 * x),
+                                        x * x * x * (10 + x * (-15 + 6 * x))};
+      int32_t e = ease(p, phase);
+      worstCurve = fmax(worstCurve, fabs(double(e) / EASE_ONE - curve[p]));
+      CHECK(e >= last);  // monotonic, so a joint never moves back
+      last = e;
+    }
+    CHECK(ease(p, 0) == 0);
+    CHECK(ease(p, EASE_PHASE_ONE) == EASE_ONE);
+    printf("profile %d: worst error %.2e of the full swing\n", p, worstCurve);
+    CHECK(worstCurve < 1e-3);  // 0.25 degree of a 250 degree swing
+  }
+
+  // the cost of one joint step: the double cosine of the old path against the table
+  const int rounds = 2000000;
+  volatile int steps = 120;
+  float sum = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) sum += oldStep(30, -60, r % (steps + 1), steps);
+  double oldNs = (nowNs() - start) / rounds;
+  keep(sum);
+  int32_t isum = 0;
+  uint32_t phaseStep = easePhaseStep(steps);
+  int32_t delta = -90 * 16;
+  start = nowNs();
+  for (int r = 0; r < rounds; r++) isum += (delta * ease(EASE_COSINE, (r % (steps + 1)) * phaseStep)) >> 15;
+  double newNs = (nowNs() - start) / rounds;
+  keep(isum);
+  printf("one joint step: %.2f ns with cos() in double, %.2f ns with the table\n", oldNs, newNs);
+  return testResult();
+}
@@ -0,0 +1,97 @@
+// PulseCapture (feedbackCapture.h) fed with mock answers of 11 feedback servos: the widths against the rule of
+// readFeedback(), with glitches and captures that start in the middle of a pulse, the modeled time of a snapshot of
+// the body against one servo at a time, and the cost of an edge
+#include <algorithm>
+#include <vector>
+#include "hostTest.h"
+#include "feedbackCapture.h"
+
+#define SERVOS 11  // the feedback servos of the body
+#define N_PULSE 3  // nPulse of espServo.h
+#define MAX_WIDTH 2600
+#define PULSE_PERIOD 3000  // us between the rising edges of an answer
+#define ATTACH_ONE 15000   // the delay() of readFeedback() before each request
+#define ATTACH_ALL 3000    // the one of captureFeedback()
+
+struct Edge {
+  uint32_t us;
+  uint8_t servo;
+  bool level;
+  bool operator<(const Edge& e) const { return us < e.us; }
+};
+
+int main() {
+  srand(21);
+  long parallelUs = 0, serialUs = 0, wrong = 0;
+  const int snapshots = 200;
+  for (int n = 0; n < snapshots; n++) {
+    PulseCapture capture[SERVOS];
+    std::vector<Edge> edges;
+    int expected[SERVOS];
+    uint32_t end = 0;
+    for (int s = 0; s < SERVOS; s++) {
+      capture[s].begin(s, N_PULSE, MAX_WIDTH);
+      uint32_t t = 1000 + rand() % 3000;  // the servo answers 1 ~ 4 ms after the request
+      if (rand() % 10 == 0) edges.push_back({t - 200, uint8_t(s), false});  // the tail of a pulse before the capture
+      long sum = 0;
+      int valid = 0;
+      int width = 500 + rand() % 2001;
+      for (int p = 0; p < N_PULSE; p++, t += PULSE_PERIOD) {
+        int w = width + rand() % 5 - 2;
+        if (rand() % 8 == 0) w = 50 + rand() % 300;  // a glitch
+        edges.push_back({t, uint8_t(s), true});
+        edges.push_back({t + w, uint8_t(s), false});
+        if (p > 0 && w >= CAPTURE_MIN_US && w <= MAX_WIDTH) {  // readFeedback() skips the first pulse and the noise
+          sum += w;
+          valid++;
+        }
+      }
+      expected[s] = valid ? int(sum / valid) : -1;
+      uint32_t answered = t - PULSE_PERIOD + width;
+      end = std::max(end, answered);
+      serialUs += ATTACH_ONE + answered;
+    }
+    std::sort(edges.begin(), edges.end());
+    for (const Edge& e : edges) capture[e.servo].edge(e.level, e.us);
+    for (int s = 0; s < SERVOS; s++) {
+      CHECK(capture[s].doneQ());
+      if (capture[s].width() != expected[s]) wrong++;
+    }
+    parallelUs += ATTACH_ALL + end;
+  }
+  CHECK(wrong == 0);
+  double parallelMs = parallelUs / 1000.0 / snapshots, serialMs = serialUs / 1000.0 / snapshots;
+  printf("%d snapshots of %d servos, %ld wrong widths. modeled: %.1f ms (%.0f Hz) in one wait, %.1f ms (%.1f Hz) "
+         "one servo at a time\n",
+         snapshots, SERVOS, wrong, parallelMs, 1000 / parallelMs, serialMs, 1000 / serialMs);
+
+  // a servo that doesn't answer has no width, and pulses after the wanted ones are ignored
+  PulseCapture c;
+  c.begin(0, N_PULSE, MAX_WIDTH);
+  CHECK(!c.doneQ() && c.width() == -1);
+  for (int p = 0; p < N_PULSE + 2; p++) {
+    c.edge(true, p * PULSE_PERIOD);
+    c.edge(false, p * PULSE_PERIOD + (p < N_PULSE ? 1000 : 2000));
+  }
+  CHECK(c.doneQ() && c.width() == 1000 && c.valid == N_PULSE - 1);
+  c.begin(0, N_PULSE, MAX_WIDTH);  // too long to be a position
+  for (int p = 0; p < N_PULSE; p++) {
+    c.edge(true, p * PULSE_PERIOD);
+    c.edge(false, p * PULSE_PERIOD + MAX_WIDTH + 1);
+  }
+  CHECK(c.doneQ() && c.width() == -1);
+
+  // the cost of an edge, the work of the interrupt
+  const int rounds = 5000000;
+  uint32_t now = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    if (c.doneQ()) c.begin(0, N_PULSE, MAX_WIDTH);
+    now += 1500;
+    c.edge(r & 1, now);
+  }
+  double edgeNs = (nowNs() - start) / rounds;
+  keep(c.sum);
+  printf("%.1f ns per edge\n", edgeNs);
+  return testResult();
+}
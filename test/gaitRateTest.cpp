@@ -0,0 +1,81 @@
+// The output of every instinct gait at 0.5x, 1x and 2x gait rate, as perform() makes it every GAIT_UPDATE_MS: the
+// frameAdvance of gaitFrameAdvance() moves the phase (SkillFrames::advancePhase() of skillFrames.h), and the walking
+// joints are interpolated at it from the compressed frames (gaitAngle()). Each output is checked against the
+// reference curve of the gait, the raw frames interpolated in double precision at rate * t / frameMs frames, and the
+// cycles completed against the time it takes
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "skillFrames.h"
+
+namespace raw {
+#include "InstinctBittleESP.h"
+}
+namespace encoded {
+#include "InstinctBittleESPCompressed.h"
+}
+
+#define SKILL_NUM (sizeof(raw::progmemPointer) / sizeof(raw::progmemPointer[0]))
+#define GAIT_UPDATE_MS 5  // RoboDog.h
+#define FRAME_MS 11       // delayShort + delayMid of RoboDog.h
+#define CYCLES 3
+
+// the raw frames of a gait interpolated at position frames from the first one
+double reference(const int8_t* data, double position, int c) {
+  int period = data[0];
+  position = fmod(position, period);
+  int k = int(position);
+  const int8_t* frames = data + 4;
+  double a = frames[k * WALKING_DOF + c], b = frames[(k + 1) % period * WALKING_DOF + c];
+  return (a + (b - a) * (position - k)) * data[3];
+}
+
+int main() {
+  easingSetup();
+  const float rates[] = {0.5, 1, 2};
+  int gaits = 0;
+  long outputs = 0;
+  double worst[3] = {}, ticksPerFrame[3] = {};
+  bool cyclesQ = true;
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    const int8_t* data = raw::progmemPointer[s];
+    int period = data[0];
+    if (period < 2) continue;
+    gaits++;
+    for (int r = 0; r < 3; r++) {
+      float frameAdvance = gaitFrameAdvance(rates[r], GAIT_UPDATE_MS, FRAME_MS);
+      SkillFrames gait;
+      gait.period = period;
+      gait.frameSize = WALKING_DOF;
+      gait.angleDataRatio = data[3];
+      gait.setFrames(encoded::progmemPointer[s] + 4, true);
+      int frame = 0, cycles = 0;
+      float framePhase = 0;
+      long ticks = long(ceil(CYCLES * period / frameAdvance));
+      for (long t = 1; t <= ticks; t++, outputs++) {  // Skill::perform()
+        int completed = gait.advancePhase(frame, framePhase, frameAdvance);
+        cycles += completed;
+        double position = double(rates[r]) * GAIT_UPDATE_MS * t / FRAME_MS;
+        if (completed) cyclesQ &= cycles == int(position / period + 1e-9);
+        for (int c = 0; c < WALKING_DOF; c++)
+          worst[r] = std::max(worst[r], fabs(gait.gaitAngle(c, frame, framePhase) - reference(data, position, c)));
+      }
+      cyclesQ &= cycles == CYCLES || cycles == CYCLES - 1;  // the last tick may stop just short of the end
+      ticksPerFrame[r] += double(ticks) / CYCLES / period;
+    }
+  }
+  for (int r = 0; r < 3; r++)
+    printf("%.1fx: frameAdvance %.4f, %.2f ticks (%.1f ms) per frame. worst difference from the reference curve %.2g "
+           "degrees\n",
+           rates[r], gaitFrameAdvance(rates[r], GAIT_UPDATE_MS, FRAME_MS), ticksPerFrame[r] / gaits,
+           ticksPerFrame[r] / gaits * GAIT_UPDATE_MS, worst[r]);
+  printf("%d gaits, %ld outputs\n", gaits, outputs);
+  CHECK(gaits > 20);
+  CHECK(cyclesQ);
+  for (int r = 0; r < 3; r++) CHECK(worst[r] < 0.01);
+  // a frame takes FRAME_MS / rate
+  CHECK(fabs(gaitFrameAdvance(1, GAIT_UPDATE_MS, FRAME_MS) - 5.0 / 11) < 1e-6);
+  CHECK(fabs(ticksPerFrame[0] / ticksPerFrame[1] - 2) < 0.01 && fabs(ticksPerFrame[1] / ticksPerFrame[2] - 2) < 0.01);
+  CHECK(gaitFrameAdvance(1, GAIT_UPDATE_MS, 0) == GAIT_UPDATE_MS);  // a frame is never shorter than 1 ms
+  return testResult();
+}
@@ -0,0 +1,102 @@
+// gaitSynth.h: the synthesized frames stay within angleLimit and follow the foot path, the cache keeps the recent gaits
+// and drops the least recently used one, and the cost of a synthesis against a cache hit
+#include <math.h>
+#include "hostTest.h"
+#include "waveTable.h"
+#include "kinematics.h"
+#include "gaitSynth.h"
+
+// angleLimit of joints 8 ~ 15 in RoboDog.h
+const int limit[8][2] = {{-200, 80}, {-200, 80}, {-80, 200}, {-80, 200},
+                         {-80, 200},  {-80, 200},  {-80, 200}, {-80, 200}};
+
+int main() {
+  waveSetup();
+
+  // the foot path: a straight stance at z, and a swing that lifts the foot by height in the middle
+  GaitPar p = {40, 20, 60, 24, {0, 50, 50, 0}, 5, 70};
+  float x, z;
+  footPath(p, 0, x, z);
+  CHECK(x == 25 && z == 70);
+  footPath(p, 0.3f, x, z);
+  CHECK(fabs(x - 5) < 1e-4 && z == 70);
+  footPath(p, 0.8f, x, z);  // the middle of the swing
+  CHECK(fabs(x - 5) < 1e-4 && fabs(z - 50) < 1e-4);
+
+  // every angle of 600 gaits is within the limits, and the reachable feet are where the path puts them
+  int8_t data[GAIT_SYNTH_LEN];
+  int gaits = 0;
+  double worstFoot = 0;
+  for (int stride = -40; stride <= 40; stride += 20)
+    for (int height = 5; height <= 35; height += 10)
+      for (int duty = 40; duty <= 80; duty += 10)
+        for (int zs = 40; zs <= 85; zs += 8) {
+          GaitPar g = {int8_t(stride), int8_t(height), int8_t(duty), 48, {0, 50, 50, 0}, 0, int8_t(zs)};
+          CHECK(synthesizeGait(g, data, limit));
+          gaits++;
+          CHECK(data[0] == 48);
+          int ratio = data[3];
+          for (int k = 0; k < 48; k++) {
+            const int8_t* frame = data + GAIT_SYNTH_HEADER + k * 8;
+            for (int j = 0; j < 8; j++) {
+              CHECK(frame[j] * ratio >= limit[j][0] - 1 && frame[j] * ratio <= limit[j][1] + 1);
+              CHECK(frame[j] != '~');
+            }
+            for (int leg = 0; leg < 4; leg++) {
+              float t = float(k) / 48 + g.phase[leg] / 100.0f, px, pz, fx, fz, s, kn;
+              t -= int(t);
+              footPath(g, t, px, pz);
+              if (!legIK(px, pz, s, kn, limit[leg], limit[4 + leg])) continue;  // clamped, so it isn't there
+              legFK(frame[leg] * ratio, frame[4 + leg] * ratio, fx, fz);
+              worstFoot = fmax(worstFoot, hypot(fx - px, fz - pz));
+            }
+          }
+        }
+  printf("%d gaits within angleLimit. the feet are within %.2f mm of their path\n", gaits, worstFoot);
+  CHECK(gaits == 600);
+  CHECK(worstFoot < 1.5);  // the angles are rounded to a whole degree
+  p.frames = 1;
+  CHECK(!synthesizeGait(p, data, limit));
+  p.frames = GAIT_SYNTH_MAX_FRAMES + 1;
+  CHECK(!synthesizeGait(p, data, limit));
+
+  // the cache: a repeat is a hit, and a new gait drops the least recently used one
+  GaitCache cache;
+  int8_t par[GAIT_CACHE_SIZE + 1][GAIT_SYNTH_PARS];
+  for (int i = 0; i <= GAIT_CACHE_SIZE; i++) {
+    int8_t q[GAIT_SYNTH_PARS] = {int8_t(10 + 5 * i), 20, 60, 24, 0, 50, 50, 0, 0, 70};
+    memcpy(par[i], q, GAIT_SYNTH_PARS);
+  }
+  const int8_t* first = cache.get(par[0], GAIT_SYNTH_PARS, limit);
+  CHECK(first && cache.misses == 1);
+  CHECK(cache.get(par[0], GAIT_SYNTH_PARS, limit) == first && cache.hits == 1);
+  // x and z default to 0 and GAIT_SYNTH_Z, so the short command is the same gait
+  CHECK(cache.get(par[0], GAIT_SYNTH_MIN_PARS, limit) == first && cache.hits == 2);
+  for (int i = 1; i < GAIT_CACHE_SIZE; i++) cache.get(par[i], GAIT_SYNTH_PARS, limit);
+  cache.get(par[0], GAIT_SYNTH_PARS, limit);  // the running gait is the most recent one
+  cache.get(par[GAIT_CACHE_SIZE], GAIT_SYNTH_PARS, limit);
+  uint16_t misses = cache.misses;
+  CHECK(cache.get(par[0], GAIT_SYNTH_PARS, limit) == first && cache.misses == misses);
+  CHECK(cache.get(par[1], GAIT_SYNTH_PARS, limit) && cache.misses == misses + 1);  // it was the oldest
+
+  // the cost of a synthesis of 48 frames and of a cache hit
+  GaitPar g = {30, 20, 60, 48, {0, 50, 50, 0}, 0, 70};
+  const int rounds = 2000;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    g.stride = 20 + r % 20;
+    synthesizeGait(g, data, limit);
+    keep(data);
+  }
+  double synthUs = (nowNs() - start) / rounds / 1000;
+  const int hits = 1000000;
+  const int8_t* d = NULL;
+  start = nowNs();
+  for (int r = 0; r < hits; r++) {
+    d = cache.get(par[r & 1], GAIT_SYNTH_PARS, limit);
+    keep(d);
+  }
+  double hitNs = (nowNs() - start) / hits;
+  printf("48 frames: %.1f us to synthesize, %.1f ns from the cache\n", synthUs, hitNs);
+  return testResult();
+}
@@ -0,0 +1,41 @@
+/* Helpers of the host tests.
+
+   The tests build the headers of src/ that have no Arduino dependency on Linux, with the few definitions of RoboDog.h
+   they need, and run them with ctest (see CMakeLists.txt). A test is a main() that CHECK()s the results, prints its
+   measurements and returns testResult().
+*/
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+int testFailures = 0;
+
+#define CHECK(cond)                                                   \
+  do {                                                                \
+    if (!(cond)) {                                                    \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      testFailures++;                                                 \
+    }                                                                 \
+  } while (0)
+
+int testResult() {
+  if (testFailures) printf("%d check(s) failed\n", testFailures);
+  return testFailures ? 1 : 0;
+}
+
+double nowNs() {
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+template <typename T>
+void keep(const T& value) {  // the optimizer can't drop the work of a benchmark loop that computed value
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+#endif
@@ -0,0 +1,82 @@
+// kinematics.h: FK(IK(p)) over the reachable joint space, the table sine and the atan2 against libm, the clamping to
+// the limits, and the solves per second
+#include <math.h>
+#include "hostTest.h"
+#include "waveTable.h"
+#include "kinematics.h"
+
+// the leg of the double formulas of the header comment
+void exactFK(double shoulder, double knee, double& x, double& z) {
+  double a = shoulder / DEG_PER_RAD, b = (shoulder + knee - 90) / DEG_PER_RAD;
+  x = LEG_UPPER * sin(a) + LEG_LOWER * sin(b);
+  z = LEG_UPPER * cos(a) + LEG_LOWER * cos(b);
+}
+
+int main() {
+  waveSetup();
+  const int noLimit[2] = {-180, 180};
+  const int kneeLimit[2] = {-89, 89};
+
+  // the helpers against libm
+  double worstSin = 0, worstAtan = 0;
+  for (float d = -720; d <= 720; d += 0.01f) worstSin = fmax(worstSin, fabs(tableSin(d) - sin(d / DEG_PER_RAD)));
+  for (int i = 0; i < 200000; i++) {
+    float y = float(rand()) / RAND_MAX * 200 - 100, x = float(rand()) / RAND_MAX * 200 - 100;
+    worstAtan = fmax(worstAtan, fabs(fastAtan2(y, x) - atan2(double(y), double(x)) * DEG_PER_RAD));
+  }
+  printf("table sine within %.1e, atan2 within %.1e degree\n", worstSin, worstAtan);
+  CHECK(worstSin < 2e-4);
+  CHECK(worstAtan < 1e-3);
+  CHECK(fastAtan2(0, 0) == 0);
+
+  // FK(IK(p)) gives p back, and IK finds the joint angles the foot was placed with
+  double worstFoot = 0, worstAngle = 0;
+  for (float a = -120; a <= 120; a += 0.5f)
+    for (float k = -85; k <= 85; k += 0.5f) {
+      double x, z;
+      exactFK(a, k, x, z);
+      float shoulder, knee, fx, fz;
+      CHECK(legIK(x, z, shoulder, knee, noLimit, kneeLimit));
+      legFK(shoulder, knee, fx, fz);
+      worstFoot = fmax(worstFoot, hypot(fx - x, fz - z));
+      worstAngle = fmax(worstAngle, fmax(fabs(shoulder - a), fabs(knee - k)));
+    }
+  printf("FK(IK(p)) within %.4f mm, IK within %.4f degree of the joint angles\n", worstFoot, worstAngle);
+  CHECK(worstFoot < 0.02);
+  CHECK(worstAngle < 0.02);
+
+  // out of reach: the leg points at the foot, straight
+  float shoulder, knee;
+  CHECK(!legIK(0, 200, shoulder, knee, noLimit, kneeLimit));
+  CHECK(fabs(shoulder) < 0.01 && fabs(knee - 89) < 0.01);  // the knee is clamped just short of straight
+  CHECK(!legIK(0, 200, shoulder, knee, noLimit, noLimit));
+  CHECK(fabs(knee - 90) < 0.01);
+  // a joint limit clamps the angle and reports it
+  const int shoulderLimit[2] = {-30, 30};
+  double x, z;
+  exactFK(50, 10, x, z);
+  CHECK(!legIK(x, z, shoulder, knee, shoulderLimit, kneeLimit));
+  CHECK(shoulder == 30);
+  exactFK(20, 10, x, z);
+  CHECK(legIK(x, z, shoulder, knee, shoulderLimit, kneeLimit));
+
+  // the cost of a solve
+  const int rounds = 2000000;
+  float sx[64], sz[64];
+  for (int i = 0; i < 64; i++) {
+    double px, pz;
+    exactFK(-60 + 2 * i, 60 - i, px, pz);
+    sx[i] = px;
+    sz[i] = pz;
+  }
+  float sum = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    legIK(sx[r & 63], sz[r & 63], shoulder, knee, noLimit, kneeLimit);
+    sum += shoulder + knee;
+  }
+  double ikNs = (nowNs() - start) / rounds;
+  keep(sum);
+  printf("one IK solve: %.1f ns, %.1f million solves per second\n", ikNs, 1000 / ikNs);
+  return testResult();
+}
@@ -0,0 +1,101 @@
+// learnLog.h through a stand-in for the LittleFS File over a plain file: a long drag round-trips frame by frame, the
+// slow frames take the delta code, a full file and a cut log stop cleanly, and the cost per frame
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include "hostTest.h"
+#include "learnLog.h"
+
+class StdioFile {  // the write() and read() of a LittleFS File
+  FILE* f;
+  long limit;  // bytes the file system has room for
+
+ public:
+  StdioFile(FILE* file, long room = 1L << 30) : f(file), limit(room) {}
+  size_t write(const uint8_t* b, size_t n) {
+    if (ftell(f) + long(n) > limit) return 0;
+    return fwrite(b, 1, n, f);
+  }
+  size_t read(uint8_t* b, size_t n) { return fread(b, 1, n, f); }
+};
+
+#define FRAMES 20000
+
+int8_t drag[FRAMES][LEARN_JOINTS];
+
+int main() {
+  srand(20);
+  // a drag: slow sweeps of every joint, and now and then a fast move that doesn't fit in 4 bits
+  for (int f = 0; f < FRAMES; f++)
+    for (int j = 0; j < LEARN_JOINTS; j++) {
+      float angle = 60 * sin(f / (40.0 + 7 * j) + j) + rand() % 3 - 1;
+      if (f % 500 < 3) angle = -angle;
+      drag[f][j] = int8_t(lroundf(angle));
+    }
+
+  FILE* f = tmpfile();
+  StdioFile out(f);
+  int8_t last[LEARN_JOINTS] = {};
+  long bytes = 0, deltas = 0;
+  double start = nowNs();
+  for (int i = 0; i < FRAMES; i++) {
+    size_t n = writeLearnFrame(out, drag[i], last, i == 0);
+    CHECK(n == 1 + LEARN_JOINTS || n == 1 + (LEARN_JOINTS + 1) / 2);
+    deltas += n < 1 + LEARN_JOINTS;
+    bytes += n;
+  }
+  double writeNs = (nowNs() - start) / FRAMES;
+  CHECK(ftell(f) == bytes);
+
+  rewind(f);
+  StdioFile in(f);
+  int8_t frame[LEARN_JOINTS] = {};
+  int read = 0;
+  start = nowNs();
+  while (readLearnFrame(in, frame)) {
+    CHECK(read < FRAMES && !memcmp(frame, drag[read], LEARN_JOINTS));
+    read++;
+  }
+  double readNs = (nowNs() - start) / FRAMES;
+  CHECK(read == FRAMES);
+  printf("%d frames, %ld raw: %.1f bytes per frame against %d raw. %.0f ns to write, %.0f ns to read a frame\n", FRAMES,
+         FRAMES - deltas, double(bytes) / FRAMES, LEARN_JOINTS, writeNs, readNs);
+  CHECK(deltas < FRAMES - 1);  // the fast moves
+  CHECK(bytes < FRAMES * 8);
+
+  // a log cut in the middle of a frame stops at the last whole frame
+  fflush(f);
+  long cut = bytes - 3;
+  rewind(f);
+  FILE* g = tmpfile();
+  uint8_t buffer[256];
+  for (long copied = 0; copied < cut;) {
+    size_t n = fread(buffer, 1, std::min(long(sizeof(buffer)), cut - copied), f);
+    fwrite(buffer, 1, n, g);
+    copied += n;
+  }
+  rewind(g);
+  StdioFile cutIn(g);
+  memset(frame, 0, sizeof(frame));
+  read = 0;
+  while (readLearnFrame(cutIn, frame)) read++;
+  CHECK(read == FRAMES - 1);
+  fclose(g);
+  fclose(f);
+
+  // a full file system: the frame that doesn't fit is reported and nothing of it is written
+  f = tmpfile();
+  StdioFile full(f, 100);
+  memset(last, 0, sizeof(last));
+  int written = 0;
+  while (writeLearnFrame(full, drag[written], last, written == 0)) written++;
+  CHECK(written > 0 && ftell(f) <= 100);
+  rewind(f);
+  StdioFile fullIn(f);
+  memset(frame, 0, sizeof(frame));
+  read = 0;
+  while (readLearnFrame(fullIn, frame)) CHECK(!memcmp(frame, drag[read++], LEARN_JOINTS));
+  CHECK(read == written);
+  fclose(f);
+  return testResult();
+}
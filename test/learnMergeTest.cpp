@@ -0,0 +1,113 @@
+// smoothMerge() (learnLog.h) on recorded joint trajectories: the instinct skills, played at the frame rate of a drag
+// with the one degree jitter of the servo feedback, are merged the way loadLearn() merges a recording, and every
+// recorded frame stays within LEARN_TOLERANCE of the replay of the kept ones
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "learnLog.h"
+#include "InstinctBittleESP.h"
+
+#define SKILL_NUM (sizeof(progmemPointer) / sizeof(progmemPointer[0]))
+#define DRAG_STEPS 6  // recorded frames between two frames of a skill
+#define RECORDING_MAX 4000
+
+int8_t recording[RECORDING_MAX][LEARN_JOINTS];
+int8_t learnData[LEARN_MAX_FRAME * LEARN_JOINTS];
+
+// the joints 0 ~ 2 and 8 ~ 15 of skill s, DRAG_STEPS recorded frames per skill frame. returns the frames
+int recordSkill(int s) {
+  const int8_t* data = progmemPointer[s];
+  int8_t period = data[0];
+  int header = period > 0 ? 4 : 7;
+  int frameSize = period > 1 ? WALKING_DOF : period == 1 ? DOF : DOF + 4;
+  int frames = abs(period), ratio = data[3], n = 0;
+  for (int k = 0; k < frames && n < RECORDING_MAX; k++) {
+    const int8_t* a = data + header + k * frameSize;
+    const int8_t* b = data + header + (k + 1) % frames * frameSize;
+    for (int step = 0; step < DRAG_STEPS && n < RECORDING_MAX; step++, n++)
+      for (int i = 0; i < LEARN_JOINTS; i++) {
+        int col = (i > 2) ? i + 5 : i;  // the joint of learnByDrag()
+        if (frameSize == WALKING_DOF) col -= DOF - WALKING_DOF;
+        float angle = col < 0 ? 0 : (a[col] + (b[col] - a[col]) * float(step) / DRAG_STEPS) * ratio;
+        recording[n][i] = std::max(-125, std::min(125, int(lroundf(angle)) + rand() % 3 - 1));  // int8_t of learnData
+      }
+  }
+  return n;
+}
+
+// merges the recording into learnData as loadLearn() does. returns the kept frames, 0 if they didn't fit
+int mergeRecording(int recorded) {
+  int total = 0, first = 0;
+  for (int f = 0; f < recorded; f++) {
+    if (total == LEARN_MAX_FRAME) {
+      total = smoothMerge(learnData, total, first);
+      first = total - 1;
+      if (total == LEARN_MAX_FRAME) return 0;
+    }
+    memcpy(learnData + total * LEARN_JOINTS, recording[f], LEARN_JOINTS);
+    total++;
+  }
+  return smoothMerge(learnData, total, first);
+}
+
+// the worst error in degrees of the recorded frames against the straight lines between the kept frames, which are
+// matched to the recording in order
+float replayError(int recorded, int kept) {
+  int at[LEARN_MAX_FRAME];
+  for (int k = 0, f = 0; k < kept; k++, f++) {
+    while (f < recorded && memcmp(recording[f], learnData + k * LEARN_JOINTS, LEARN_JOINTS)) f++;
+    if (f == recorded) return 999;  // not a frame of the recording
+    at[k] = f;
+  }
+  if (at[0] != 0 || at[kept - 1] != recorded - 1) return 999;
+  float worst = 0;
+  for (int k = 0; k + 1 < kept; k++)
+    for (int f = at[k]; f <= at[k + 1]; f++)
+      for (int i = 0; i < LEARN_JOINTS; i++) {
+        float a = learnData[k * LEARN_JOINTS + i], b = learnData[(k + 1) * LEARN_JOINTS + i];
+        float replay = a + (b - a) * (f - at[k]) / float(at[k + 1] - at[k]);
+        worst = fmax(worst, fabs(recording[f][i] - replay));
+      }
+  return worst;
+}
+
+int main() {
+  srand(19);
+  long recordedSum = 0, keptSum = 0;
+  int skills = 0, cut = 0;
+  float worst = 0, worstRatio = 1e9;
+  double mergeNs = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    int recorded = recordSkill(s);
+    if (recorded < 3) continue;
+    double start = nowNs();
+    int kept = mergeRecording(recorded);
+    mergeNs += nowNs() - start;
+    if (!kept) {  // too many frames to keep
+      cut++;
+      continue;
+    }
+    float err = replayError(recorded, kept);
+    CHECK(err <= LEARN_TOLERANCE);
+    worst = fmax(worst, err);
+    worstRatio = fmin(worstRatio, float(recorded) / kept);
+    recordedSum += recorded;
+    keptSum += kept;
+    skills++;
+  }
+  printf("%d recorded skills, %d cut: %ld -> %ld frames (%.1fx, worst %.1fx), within %.2f degree, %.0f us each\n",
+         skills, cut, recordedSum, keptSum, float(recordedSum) / keptSum, worstRatio, worst, mergeNs / skills / 1000);
+  CHECK(cut == 0);
+  CHECK(recordedSum > 4 * keptSum);
+
+  // a straight ramp of all the joints keeps its two ends, and a sharp zigzag keeps all of its corners
+  int8_t line[LEARN_MAX_FRAME * LEARN_JOINTS];
+  for (int f = 0; f < LEARN_MAX_FRAME; f++)
+    for (int i = 0; i < LEARN_JOINTS; i++) line[f * LEARN_JOINTS + i] = f / 2 - i;
+  CHECK(smoothMerge(line, LEARN_MAX_FRAME) <= 3);  // the rounding of f / 2 is within the tolerance
+  for (int f = 0; f < LEARN_MAX_FRAME; f++)
+    for (int i = 0; i < LEARN_JOINTS; i++) line[f * LEARN_JOINTS + i] = (f % 2) * 20;
+  CHECK(smoothMerge(line, LEARN_MAX_FRAME) == LEARN_MAX_FRAME);
+  CHECK(smoothMerge(line, 2) == 2);
+  return testResult();
+}
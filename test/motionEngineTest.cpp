@@ -0,0 +1,119 @@
+// MotionEngine (motionEngine.h): first-step latency, landing, step timing on a coarse clock, and the cost of a step
+#define DOF 16
+#include "hostTest.h"
+#include "motionEngine.h"
+
+// runs a trajectory with a caller that calls advance() every period ms. returns the time of the last step
+unsigned long runTrajectory(MotionEngine& engine, unsigned long period, int* sent, float* dutyAng) {
+  unsigned long now = 0, last = 0;
+  *sent = 0;
+  while (!engine.idle() && now < 100000) {
+    if (engine.advance(now, dutyAng)) {
+      (*sent)++;
+      last = now;
+    }
+    now += period;
+  }
+  return last;
+}
+
+int main() {
+  int current[DOF] = {};
+  int8_t target[DOF];
+  for (int i = 0; i < DOF; i++) target[i] = i % 2 ? 60 : -45;
+  float dutyAng[DOF];
+
+  // the first step goes out on the call right after submit()
+  MotionEngine engine;
+  engine.submit(target, current);
+  CHECK(engine.steps == 60);
+  CHECK(engine.advance(0, dutyAng));
+  CHECK(engine.step == 2 && dutyAng[1] >= 0 && dutyAng[1] < 1);  // the cosine starts slowly
+  CHECK(!engine.advance(0, dutyAng));  // the next one waits for stepInterval
+
+  // a caller at 1 ms gets every step, and the last one lands exactly on the target
+  engine.submit(target, current);
+  int sent;
+  unsigned long end = runTrajectory(engine, 1, &sent, dutyAng);
+  CHECK(sent == engine.steps);
+  CHECK(end == (unsigned long)(engine.steps - 1) * engine.stepInterval);
+  for (int i = 0; i < DOF; i++) CHECK(dutyAng[i] == target[i]);
+
+  // the 5 ms ticks of the control loop keep the 8 ms grid of a full-body transition instead of rounding it up to 10 ms
+  engine.submit(target, current);
+  CHECK(engine.stepInterval == 8);
+  end = runTrajectory(engine, 5, &sent, dutyAng);
+  unsigned long grid = (engine.steps - 1) * engine.stepInterval;
+  printf("full body: %d steps of %d ms, last step at %lu ms on 5 ms ticks (grid %lu ms)\n", engine.steps,
+         engine.stepInterval, end, grid);
+  CHECK(end >= grid && end < grid + 5);
+  CHECK(sent == engine.steps);
+
+  // a 4 ms grid (the legs only) on 5 ms ticks skips steps to stay on time
+  int legs[DOF];
+  for (int i = 0; i < DOF; i++) legs[i] = 30;
+  engine.submit(legs, current, 1, 1, 8);
+  CHECK(engine.stepInterval == 4);
+  end = runTrajectory(engine, 5, &sent, dutyAng);
+  grid = (engine.steps - 1) * engine.stepInterval;
+  printf("legs: %d steps of %d ms, %d sent, last step at %lu ms on 5 ms ticks (grid %lu ms)\n", engine.steps,
+         engine.stepInterval, sent, end, grid);
+  CHECK(end >= grid && end < grid + 5);
+  CHECK(sent < engine.steps);
+  for (int i = 0; i < 8; i++) CHECK(!engine.activeJoint[i]);
+  for (int i = 8; i < DOF; i++) CHECK(dutyAng[i] == 30);
+
+  // after a stall the trajectory goes on from the next step instead of jumping to where the grid is
+  engine.submit(target, current);
+  engine.advance(0, dutyAng);
+  engine.advance(8, dutyAng);
+  CHECK(engine.step == 3);
+  CHECK(engine.advance(500, dutyAng));
+  CHECK(engine.step == 4);
+  CHECK(!engine.advance(507, dutyAng));
+  CHECK(engine.advance(508, dutyAng));
+
+  // the head is left alone while it's controlled manually
+  engine.submit(target, current, 1, 1, 0, 4);
+  for (int i = 0; i < DOF; i++) CHECK(engine.activeJoint[i] == (i >= 4));
+
+  // a speed ratio of 0 jumps to the target in one step
+  engine.submit(target, current, 1, 0);
+  CHECK(engine.advance(0, dutyAng) && engine.idle());
+  CHECK(dutyAng[3] == target[3]);
+
+  // the e token picks the easing of the next trajectory, and the running one keeps its own
+  engine.submit(target, current);
+  engine.advance(0, dutyAng);
+  engine.easing = EASE_LINEAR;
+  engine.advance(8, dutyAng);
+  CHECK(dutyAng[1] < 1);  // step 2 is still on the slow start of the cosine
+  engine.submit(target, current);
+  engine.advance(0, dutyAng);
+  engine.advance(8, dutyAng);
+  CHECK(fabs(dutyAng[1] - 2) < 0.1);  // one degree per step from the first one
+  engine.easing = EASE_COSINE;
+
+  // a frame of some joints goes out in one step, and leaves the others alone
+  bool activeQ[DOF] = {};
+  activeQ[8] = activeQ[11] = true;
+  float frame[DOF];
+  for (int i = 0; i < DOF; i++) frame[i] = dutyAng[i] = -i;
+  engine.submitFrame(frame, activeQ);
+  CHECK(!engine.idle());
+  for (int i = 0; i < DOF; i++) dutyAng[i] = 100;
+  CHECK(engine.advance(0, dutyAng) && engine.idle());
+  for (int i = 0; i < DOF; i++) CHECK(engine.activeJoint[i] == activeQ[i] && dutyAng[i] == (activeQ[i] ? -i : 100));
+
+  // the cost of a step of all the joints
+  const int rounds = 20000;
+  long steps = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    engine.submit(target, current);
+    for (unsigned long now = 0; engine.advance(now, dutyAng); now += engine.stepInterval) steps++;
+    keep(dutyAng);
+  }
+  printf("%.1f ns per step of %d joints\n", (nowNs() - start) / steps, DOF);
+  return testResult();
+}
@@ -0,0 +1,87 @@
+// SkillFrames::nearestFrame() (skillFrames.h) over every ordered pair of instinct gaits, from four phases of the gait
+// that was running: the joint travel of the transition into the next gait from its first frame and from the nearest
+// one, the frame it picks against a search over the raw frames, and the time of a search of a compressed gait
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "skillFrames.h"
+
+namespace raw {
+#include "InstinctBittleESP.h"
+}
+namespace encoded {
+#include "InstinctBittleESPCompressed.h"
+}
+
+#define SKILL_NUM (sizeof(raw::progmemPointer) / sizeof(raw::progmemPointer[0]))
+#define PHASES 4  // of the gait that was running
+
+int rawAngle(const int8_t* data, int k, int col) {
+  return data[4 + k * WALKING_DOF + col] * data[3];
+}
+
+void loadGait(SkillFrames& g, const int8_t* data) {  // Skill::buildSkill() of a compressed gait
+  g.period = data[0];
+  g.frameSize = WALKING_DOF;
+  g.angleDataRatio = data[3];
+  g.setFrames(data + 4, true);
+}
+
+int main() {
+  int gaits[SKILL_NUM], gaitNum = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++)
+    if (raw::progmemPointer[s][0] > 1) gaits[gaitNum++] = s;
+
+  SkillFrames next;
+  long firstTravel = 0, nearestTravel = 0, searches = 0, wrong = 0, longer = 0;
+  double searchNs = 0;
+  long frames = 0, sum = 0;
+  for (int ia = 0; ia < gaitNum; ia++)
+    for (int ib = 0; ib < gaitNum; ib++) {
+      if (ia == ib) continue;
+      const int8_t *from = raw::progmemPointer[gaits[ia]], *to = raw::progmemPointer[gaits[ib]];
+      for (int p = 0; p < PHASES; p++, searches++) {
+        int pose[WALKING_DOF];
+        for (int col = 0; col < WALKING_DOF; col++) pose[col] = rawAngle(from, p * from[0] / PHASES, col);
+        loadGait(next, encoded::progmemPointer[gaits[ib]]);
+        double start = nowNs();
+        int k = next.nearestFrame(pose);
+        searchNs += nowNs() - start;
+        frames += to[0];
+        sum += k;
+
+        long best = -1;  // the same search over the raw frames
+        int bestK = 0;
+        for (int f = 0; f < to[0]; f++) {
+          long distance = 0;
+          for (int col = 0; col < WALKING_DOF; col++) {
+            long d = rawAngle(to, f, col) - pose[col];
+            distance += nearestFrameWeight[col] * d * d;
+          }
+          if (best < 0 || distance < best) {
+            best = distance;
+            bestK = f;
+          }
+        }
+        wrong += k != bestK;
+        long travelFirst = 0, travelNearest = 0;
+        for (int col = 0; col < WALKING_DOF; col++) {
+          travelFirst += abs(rawAngle(to, 0, col) - pose[col]);
+          travelNearest += abs(rawAngle(to, k, col) - pose[col]);
+        }
+        firstTravel += travelFirst;
+        nearestTravel += travelNearest;
+        longer += travelNearest > travelFirst;
+      }
+    }
+  keep(sum);
+  printf("%d gaits, %ld transitions (%d pairs x %d phases): %ld degrees of joint travel from the first frame, %ld from "
+         "the nearest (%+.1f%%). %ld transitions travel further, %ld picks differ from the raw search\n",
+         gaitNum, searches, gaitNum * (gaitNum - 1), PHASES, firstTravel, nearestTravel,
+         100.0 * (nearestTravel - firstTravel) / firstTravel, longer, wrong);
+  printf("a search: %.0f ns, %.1f ns per frame of a compressed gait\n", searchNs / searches, searchNs / frames);
+  CHECK(gaitNum > 20);
+  CHECK(wrong == 0);
+  CHECK(nearestTravel < firstTravel * 0.9);
+  return testResult();
+}
@@ -0,0 +1,169 @@
+// PCA9685Output (servoOutput.h) on a mock I2C bus: the layout of the auto-increment burst, the span of the changed
+// channels, full off, a NACKed burst and a busy bus sent again by the next commit(), a stage() during a burst, the
+// prescale of setPWMFreq(), and the bytes on the wire per frame of wkF against one setPWM() transaction per channel
+#include <string.h>
+#include <vector>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#define PCA9685_SERVO
+#define SERVO_FREQ 240  // RoboDog.h
+#include "servoOutput.h"
+#include "dutyTable.h"
+#include "InstinctBittleESP.h"
+
+#define ADDRESS 0x40  // PCA9685_I2C_ADDRESS
+#define PWM_NUM 12
+#define P1S_RANGE 290  // SERVO_P1S of espServo.h
+#define SET_PWM_BYTES 6  // the address, the register and the 4 bytes of Adafruit_PWMServoDriver::setPWM()
+#define I2C_HZ 400000
+
+typedef DutyTable<P1S_RANGE, SERVO_FREQ, 500, 2500> dutyP1S;
+
+const int8_t middleShift[DOF] = {0, -90, 0, 0, -45, -45, -45, -45, 55, 55, -55, -55, -55, -55, -55, -55};
+const int8_t rotationDirection[DOF] = {1, -1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, 1, -1};
+
+struct MockBus {  // the transactions of TwoWire, with the address byte
+  std::vector<std::vector<uint8_t> > sent;
+  std::vector<uint8_t> open;
+  uint8_t nack;          // the result of the next endTransmission()
+  void (*duringWrite)();  // the other task, while the burst is on the wire
+  MockBus() : nack(0), duringWrite(NULL) {}
+  void beginTransmission(uint8_t address) { open.assign(1, address << 1); }
+  size_t write(const uint8_t* b, size_t n) {
+    open.insert(open.end(), b, b + n);
+    if (duringWrite) duringWrite();
+    duringWrite = NULL;
+    return n;
+  }
+  uint8_t endTransmission() {
+    uint8_t result = nack;
+    if (!nack) sent.push_back(open);
+    nack = 0;
+    return result;
+  }
+  long bytes() {
+    long n = 0;
+    for (size_t t = 0; t < sent.size(); t++) n += sent[t].size();
+    return n;
+  }
+};
+
+struct MockLock {  // I2cLock, held by the IMU when busy
+  bool busy, held;
+  MockLock() : busy(false), held(false) {}
+  bool tryLock() {
+    if (busy || held) return false;
+    held = true;
+    return true;
+  }
+  void unlock() { held = false; }
+};
+
+PCA9685Output<MockBus, MockLock>* board;
+void stageChannel4() {
+  board->stage(4, 777);
+}
+
+int offTicks(const std::vector<uint8_t>& t, int c) {  // of channel c in a burst that starts at channel 0
+  return t[2 + 4 * c + 2] | t[2 + 4 * c + 3] << 8;
+}
+
+int main() {
+  // the prescale of Adafruit_PWMServoDriver::setPWMFreq() over the whole range of the board
+  for (int freq = 1; freq <= 3500; freq++) {
+    float prescale = PCA9685_OSCILLATOR / (freq * 4096.0) + 0.5 - 1;
+    prescale = prescale < 3 ? 3 : (prescale > 255 ? 255 : prescale);
+    CHECK(pca9685Prescale(freq) == int(prescale));
+  }
+
+  MockBus bus;
+  MockLock lock;
+  PCA9685Output<MockBus, MockLock> pca(bus, ADDRESS, &lock);
+  pca.setPrescale(PCA9685_OSCILLATOR, pca9685Prescale(SERVO_FREQ));
+  CHECK(pca9685Prescale(SERVO_FREQ) == 24 && pca.gain(0) == 65536);  // a tick is 25 / 25 MHz, a us
+
+  // a whole frame is one burst from LED0_ON_L: every pulse starts at 0, full off is bit 4 of LEDn_OFF_H
+  for (int c = 0; c < PCA9685_CHANNELS; c++) pca.stage(c, c == 7 ? 0 : 300 + 100 * c);
+  pca.stage(15, 5000);
+  CHECK(pca.commit() && !lock.held);
+  CHECK(bus.sent.size() == 1);
+  const std::vector<uint8_t>& frame = bus.sent[0];
+  CHECK(frame.size() == 2 + 4 * PCA9685_CHANNELS);
+  CHECK(frame[0] == ADDRESS << 1 && frame[1] == PCA9685_LED0_ON_L);
+  for (int c = 0; c < PCA9685_CHANNELS; c++) {
+    CHECK(frame[2 + 4 * c] == 0 && frame[2 + 4 * c + 1] == 0);
+    CHECK(offTicks(frame, c) == (c == 7 ? PCA9685_FULL_OFF : c == 15 ? 4095 : 300 + 100 * c));
+  }
+  uint8_t buf[PCA9685_BURST_LEN];
+  uint16_t off[PCA9685_CHANNELS];
+  for (int c = 0; c < PCA9685_CHANNELS; c++) off[c] = offTicks(frame, c);
+  CHECK(packPCA9685Burst(off, 0, PCA9685_CHANNELS - 1, buf) == PCA9685_BURST_LEN);
+  CHECK(!memcmp(buf, frame.data() + 1, PCA9685_BURST_LEN));
+
+  // nothing changed: nothing sent. one channel: its 4 registers. two: the span between them
+  CHECK(pca.commit() && bus.sent.size() == 1);
+  pca.stage(5, 1234);
+  CHECK(pca.commit() && bus.sent.size() == 2);
+  CHECK(bus.sent[1].size() == 2 + 4 && bus.sent[1][1] == PCA9685_LED0_ON_L + 4 * 5);
+  CHECK(bus.sent[1][4] == (1234 & 0xFF) && bus.sent[1][5] == 1234 >> 8);
+  pca.stage(3, 1000);
+  pca.stage(9, 1000);
+  CHECK(pca.commit() && bus.sent.size() == 3);
+  CHECK(bus.sent[2].size() == 2 + 4 * 7 && bus.sent[2][1] == PCA9685_LED0_ON_L + 4 * 3);
+
+  // a NACKed burst and a busy bus keep the staged ticks, and the next commit() sends them
+  pca.stage(2, 2000);
+  bus.nack = 2;
+  CHECK(!pca.commit() && !lock.held && bus.sent.size() == 3);
+  lock.busy = true;
+  CHECK(!pca.commit() && bus.sent.size() == 3);
+  lock.busy = false;
+  CHECK(pca.commit() && bus.sent.size() == 4);
+  CHECK(bus.sent[3].size() == 2 + 4 && bus.sent[3][1] == PCA9685_LED0_ON_L + 4 * 2);
+  CHECK(pca.bursts == 4);
+
+  // a stage() from the other task during a burst isn't taken as sent
+  board = &pca;
+  pca.stage(4, 701);
+  bus.duringWrite = stageChannel4;
+  CHECK(pca.commit() && bus.sent.size() == 5 && offTicks(bus.sent[4], 0) == 701);
+  CHECK(pca.commit() && bus.sent.size() == 6);
+  CHECK(bus.sent[5].size() == 2 + 4 && bus.sent[5][1] == PCA9685_LED0_ON_L + 4 * 4 && offTicks(bus.sent[5], 0) == 777);
+  CHECK(pca.bursts == 6);
+
+  // wkF at one frame per 5 ms tick, with the P1S duty table of the board
+  ServoTicks p1s = {P1S_RANGE, dutyP1S::tick, pca.gain(0)};
+  const int8_t* wkF = progmemPointer[29];
+  CHECK(!strcmp(skillNameWithType[29], "wkFI"));
+  int period = wkF[0], ratio = wkF[3];
+  int ticks[PWM_NUM];
+  size_t transactions = 0;
+  long bytes = 0;
+  for (int cycle = 0; cycle < 2; cycle++) {  // the first cycle starts from full off
+    transactions = bus.sent.size();
+    bytes = bus.bytes();
+    for (int k = 0; k < period; k++) {
+      const int8_t* joints = wkF + 4 + k * WALKING_DOF;
+      for (int i = 0; i < DOF; i++) {
+        if (i > 3 && i < 8) continue;
+        float a = i < DOF - WALKING_DOF ? 0 : joints[i - (DOF - WALKING_DOF)] * ratio;
+        int zero = P1S_RANGE / 2 + middleShift[i] * rotationDirection[i];
+        ticks[i > 3 ? i - 4 : i] = angleTicks(p1s, zero, rotationDirection[i], a);
+      }
+      CHECK(outputFrame(&pca, ticks, PWM_NUM));
+    }
+  }
+  transactions = bus.sent.size() - transactions;
+  bytes = bus.bytes() - bytes;
+  long setPWMBytes = long(period) * PWM_NUM * SET_PWM_BYTES;
+  // 9 clocks a byte, and about 2 for the START and the STOP of a transaction
+  double burstUs = (9.0 * bytes + 2.0 * transactions) * 1e6 / I2C_HZ / period;
+  double setPWMUs = (9.0 * setPWMBytes + 2.0 * period * PWM_NUM) * 1e6 / I2C_HZ / period;
+  printf("wkF, %d frames: %.1f bytes and %.2f bursts per frame (%.0f us at 400 kHz) against %d bytes in %d setPWM() "
+         "(%.0f us)\n",
+         period, double(bytes) / period, double(transactions) / period, burstUs, PWM_NUM * SET_PWM_BYTES, PWM_NUM,
+         setPWMUs);
+  CHECK(transactions <= size_t(period));
+  CHECK(bytes < setPWMBytes / 2);
+  return testResult();
+}
@@ -0,0 +1,129 @@
+// The batch output of a frame: angleTicks() (dutyTable.h) against the float path of Servo::write(), outputFrame()
+// (servoOutput.h) staging a whole frame before its commit, and the channel writes a wkF cycle saves by skipping the
+// channels that didn't change
+#include "arduinoStub.h"
+#include "hostTest.h"
+#define DEFAULT_TIMER_WIDTH 16  // ESP32Servo.h
+#define REFRESH_USEC 20000
+#define SERVO_FREQ 240  // RoboDog.h
+#include "servoOutput.h"
+#include "dutyTable.h"
+#include "InstinctBittleESP.h"
+
+#define PWM_NUM 12
+#define P1S_RANGE 290  // SERVO_P1S of espServo.h
+#define P1S_MIN 500
+#define P1S_MAX 2500
+
+typedef DutyTable<P1S_RANGE, SERVO_FREQ, P1S_MIN, P1S_MAX> dutyP1S;
+
+const int8_t middleShift[DOF] = {0, -90, 0, 0, -45, -45, -45, -45, 55, 55, -55, -55, -55, -55, -55, -55};
+const int8_t rotationDirection[DOF] = {1, -1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, 1, -1};
+
+int floatTicks(float us) {  // Servo::usToTicks()
+  return (int)((float)us / ((float)REFRESH_USEC / (float)(1 << DEFAULT_TIMER_WIDTH)) * (((float)SERVO_FREQ) / 50.0));
+}
+
+float halfDegreeUs(int half) {  // Servo::write() maps an integer degree with map(). between them the width is exact
+  if (half % 2 == 0) return P1S_MIN + long(half / 2) * (P1S_MAX - P1S_MIN) / P1S_RANGE;
+  return P1S_MIN + half / 2.0f * (P1S_MAX - P1S_MIN) / P1S_RANGE;
+}
+
+class RecordingOutput : public ServoOutput {  // logs the calls, and skips a channel like Servo::writeTicks()
+ public:
+  char log[64];
+  int logLen, requested, written;
+  int committed[PWM_NUM];
+  RecordingOutput() {
+    logLen = requested = written = 0;
+    for (int s = 0; s < PWM_NUM; s++) committed[s] = -1;
+  }
+  void attach(uint8_t s) {}
+  bool attached(uint8_t s) { return true; }
+  uint32_t gain(uint8_t s) { return 0; }
+  void stage(uint8_t s, int ticks) {
+    if (logLen < 63) log[logLen++] = 'a' + s;
+    requested++;
+    if (ticks != committed[s]) written++;
+    committed[s] = ticks;
+  }
+  bool commit() {
+    if (logLen < 63) log[logLen++] = '|';
+    log[logLen] = '\0';
+    return true;
+  }
+};
+
+struct MockBus {
+  long bytes;
+  void beginTransmission(uint8_t address) {}
+  size_t write(const uint8_t* b, size_t n) {
+    bytes += n;
+    return n;
+  }
+  uint8_t endTransmission() { return 0; }
+};
+struct NoLock {
+  bool tryLock() { return true; }
+  void unlock() {}
+};
+
+int main() {
+  ServoTicks p1s = {P1S_RANGE, dutyP1S::tick, 0};
+  int zero[DOF];
+  srand(22);
+  for (int j = 0; j < DOF; j++) zero[j] = P1S_RANGE / 2 + middleShift[j] * rotationDirection[j] + rand() % 9 - 4;
+
+  // every joint angle, in quarter degrees, within a tick of the float path at the same half degree
+  int worst = 0;
+  for (int j = 0; j < DOF; j++)
+    for (float a = -180; a <= 180; a += 0.25f) {
+      int half = int(2 * (zero[j] + a * rotationDirection[j]));
+      half = std::max(0, std::min(2 * P1S_RANGE, half));
+      worst = std::max(worst, abs(angleTicks(p1s, zero[j], rotationDirection[j], a) - floatTicks(halfDegreeUs(half))));
+    }
+  printf("joint angles to P1S ticks: worst difference from the float path %d tick\n", worst);
+  CHECK(worst <= 1);
+
+  // a frame is staged channel after channel, and committed once. -1 leaves a channel alone
+  RecordingOutput out;
+  int ticks[PWM_NUM];
+  for (int s = 0; s < PWM_NUM; s++) ticks[s] = s == 2 ? -1 : 2000 + s;
+  CHECK(outputFrame(&out, ticks, PWM_NUM));
+  CHECK(!strcmp(out.log, "abdefghijkl|"));
+
+  // wkF at one frame per 5 ms tick: the head holds still and most leg joints change on some frames only
+  const int8_t* wkF = progmemPointer[29];
+  CHECK(!strcmp(skillNameWithType[29], "wkFI"));
+  int period = wkF[0], ratio = wkF[3];
+  RecordingOutput ledc;
+  MockBus bus = {0};
+  PCA9685Output<MockBus, NoLock> pca(bus, 0x40, NULL);
+  for (int cycle = 0; cycle < 3; cycle++) {
+    int requested = ledc.requested, written = ledc.written;
+    long bytes = bus.bytes;
+    for (int k = 0; k < period; k++) {
+      const int8_t* frame = wkF + 4 + k * WALKING_DOF;
+      for (int i = 0; i < DOF; i++) {
+        if (i > 3 && i < 8) continue;
+        int s = i > 3 ? i - 4 : i;
+        float a = i < DOF - WALKING_DOF ? 0 : frame[i - (DOF - WALKING_DOF)] * ratio;
+        ticks[s] = angleTicks(p1s, zero[i], rotationDirection[i], a);
+      }
+      outputFrame(&ledc, ticks, PWM_NUM);
+      for (int s = 0; s < PWM_NUM; s++) pca.stage(s, ticks[s] >> 4);  // the PCA9685 has 12 bits
+      CHECK(pca.commit());
+    }
+    if (cycle == 2) {  // the first cycle starts from nothing
+      int cycleRequested = ledc.requested - requested, cycleWritten = ledc.written - written;
+      printf("wkF cycle of %d frames: %d channel writes requested, %d issued (%.0f%% saved). PCA9685: %ld bytes, %d for "
+             "full bursts\n",
+             period, cycleRequested, cycleWritten, 100.0 * (cycleRequested - cycleWritten) / cycleRequested,
+             bus.bytes - bytes, period * (1 + 4 * PWM_NUM));
+      CHECK(cycleRequested == period * PWM_NUM);
+      CHECK(cycleWritten <= period * WALKING_DOF);
+      CHECK(bus.bytes - bytes < period * (1 + 4 * PWM_NUM));
+    }
+  }
+  return testResult();
+}
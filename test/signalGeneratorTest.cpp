@@ -0,0 +1,118 @@
+// SignalGenerator (signalGenerator.h): the sine against the double formula of the old blocking generator, the rate
+// and phase over long runs, the other shapes, the phase across rate changes, and the cost of a tick of 12 joints
+// against one old step
+#include <math.h>
+#include <algorithm>
+#include "hostTest.h"
+#include "waveTable.h"
+#include "signalGenerator.h"
+
+// the angle of the old generator at sweep angle t (degrees of the resolution sweep)
+double oldAngle(int midpoint, int amp, int freq, int phase, double t) {
+  return midpoint + amp * sin(2.0 * M_PI * ((t + phase * 3.0 / freq) / (360.0 / freq)));
+}
+
+int main() {
+  SignalGenerator gen;
+
+  // 12 joints with different amplitudes, frequencies, phases and speeds, over 40 old sweeps each
+  double worst = 0;
+  for (int j = 0; j < SIGNAL_MAX_JOINTS; j++)
+    CHECK(gen.set(j, j * 3 - 10, 20 + 5 * j, 1 + j % 4, 10 * j, 2 + j % 3, 1 + j % 2, WAVE_SINE));
+  CHECK(gen.count == SIGNAL_MAX_JOINTS);
+  CHECK(!gen.set(SIGNAL_MAX_JOINTS, 0, 10, 1, 0, 1, 1, WAVE_SINE));  // no room for a 13th joint
+  CHECK(gen.set(3, 0, 30, 2, 0, 2, 1, WAVE_SINE) && gen.count == SIGNAL_MAX_JOINTS);  // joint 3 takes the new wave
+  CHECK(gen.set(3, 9 - 10, 35, 4, 30, 2, 2, WAVE_SINE));
+  for (long tick = 0; tick < 40 * 360 * SIGNAL_STEP_TICKS; tick++) {
+    for (int j = 0; j < SIGNAL_MAX_JOINTS; j++) {
+      int resolution = 2 + j % 3, speed = 1 + j % 2;
+      if (j == 3) speed = 2;
+      double t = double(tick) * speed / SIGNAL_STEP_TICKS * resolution;  // the sweep angle the old steps reached
+      int freq = j == 3 ? 4 : 1 + j % 4;
+      double exact = oldAngle(gen.osc[j].midpoint, gen.osc[j].amplitude, freq, j == 3 ? 30 : 10 * j, t);
+      worst = fmax(worst, fabs(gen.angle(j) - exact));
+    }
+    gen.advance();
+  }
+  printf("12 joints over 40 sweeps: worst difference from the double sine %.3f degree\n", worst);
+  CHECK(worst <= 0.5 + 0.05);  // the rounding to a whole degree, and the table
+
+  // the accumulator keeps the rate: the phase drifts less than 1/1000 of a cycle over 10 million ticks
+  gen.clear();
+  gen.set(0, 0, 60, 3, 0, 7, 1, WAVE_SINE);
+  double cyclesPerTick = 3.0 * 7 / (360.0 * SIGNAL_STEP_TICKS);
+  const long longRun = 10000000;
+  for (long tick = 0; tick < longRun; tick++) gen.advance();
+  double expected = fmod(cyclesPerTick * longRun, 1.0);
+  double drift = fabs(gen.osc[0].phase / 4294967296.0 - expected);
+  printf("phase drift after %ld ticks: %.6f cycle\n", longRun, fmin(drift, 1 - drift));
+  CHECK(fmin(drift, 1 - drift) < 1e-3);
+
+  // the fastest rate is clamped below half a cycle per tick, and negative frequencies run backwards
+  gen.set(0, 0, 60, 127, 0, 127, 127, WAVE_SINE);
+  CHECK(gen.osc[0].step > 0 && gen.osc[0].step < int32_t(0.5 * 4294967296.0));
+  gen.set(1, 0, 60, -2, 0, 10, 1, WAVE_SINE);
+  CHECK(gen.osc[1].step < 0);
+
+  // the other shapes peak where the sine does and stay in range
+  gen.clear();
+  gen.set(0, 0, 40, 1, 0, 1, 1, WAVE_TRIANGLE);
+  gen.set(1, 0, 40, 1, 0, 1, 1, WAVE_SQUARE);
+  int8_t ramp[WAVE_USER_LEN];
+  for (int i = 0; i < WAVE_USER_LEN; i++) ramp[i] = 3 * (i < WAVE_USER_LEN / 2 ? i : WAVE_USER_LEN - i);
+  setUserWave(1, ramp);
+  gen.set(2, 0, 40, 1, 0, 1, 1, WAVE_USER + 1);
+  int peak[3] = {-99, -99, -99}, trough[3] = {99, 99, 99};
+  for (int tick = 0; tick < 360 * SIGNAL_STEP_TICKS; tick++) {
+    for (int i = 0; i < 3; i++) {
+      peak[i] = std::max(peak[i], gen.angle(i));
+      trough[i] = std::min(trough[i], gen.angle(i));
+    }
+    if (tick == 90 * SIGNAL_STEP_TICKS) CHECK(gen.angle(0) == 40 && gen.angle(1) == 40);
+    gen.advance();
+  }
+  CHECK(peak[0] == 40 && trough[0] == -40 && peak[1] == 40 && trough[1] == -40);
+  CHECK(trough[2] == 0 && peak[2] == lround(40 * 96 / 125.0));
+
+  // a new rate keeps the running phase, so the angle moves no more at the change than in a tick at the fastest rate.
+  // a new phase argument moves the running phase by the difference
+  gen.clear();
+  gen.set(0, 0, 60, 1, 0, 2, 1, WAVE_SINE);
+  int last = gen.angle(0), tickStep = 0, changeStep = 0;
+  for (int tick = 1; tick <= 40000; tick++) {
+    bool changeQ = tick % 997 == 0;
+    if (changeQ) gen.set(0, 0, 60, 1 + tick / 997 % 4, 0, 2, 1 + tick / 997 % 3, WAVE_SINE);
+    gen.advance();
+    int a = gen.angle(0);
+    if (changeQ)
+      changeStep = std::max(changeStep, abs(a - last));
+    else
+      tickStep = std::max(tickStep, abs(a - last));
+    last = a;
+  }
+  uint32_t before = gen.osc[0].phase;
+  gen.set(0, 0, 60, 1, SIGNAL_PHASE_FULL / 4, 2, 1, WAVE_SINE);
+  printf("rate changes: the angle moves %d degrees at a change, up to %d in a tick\n", changeStep, tickStep);
+  CHECK(changeStep <= tickStep);
+  CHECK(gen.osc[0].phase - before == 1u << 30);
+
+  // the cost of a tick of 12 joints, and of one step of the old generator
+  gen.clear();
+  for (int j = 0; j < SIGNAL_MAX_JOINTS; j++) gen.set(j, 0, 30, 1 + j % 4, 10 * j, 2, 1, WAVE_SINE);
+  const int rounds = 1000000;
+  long sum = 0;
+  double start = nowNs();
+  for (int r = 0; r < rounds; r++) {
+    for (int j = 0; j < SIGNAL_MAX_JOINTS; j++) sum += gen.angle(j);
+    gen.advance();
+  }
+  double tickNs = (nowNs() - start) / rounds;
+  keep(sum);
+  start = nowNs();
+  for (int r = 0; r < rounds; r++)
+    for (int j = 0; j < SIGNAL_MAX_JOINTS; j++) sum += lround(oldAngle(0, 30, 1 + j % 4, 10 * j, r % 360));
+  double oldNs = (nowNs() - start) / rounds;
+  keep(sum);
+  printf("12 joints: %.1f ns per tick, the old step computed them in %.1f ns\n", tickNs, oldNs);
+  return testResult();
+}
@@ -0,0 +1,95 @@
+// FrameDecoder (skillCodec.h) against InstinctBittleESP.h: every frame of every instinct skill decodes to the raw
+// frame, read in order, at random, and in the interleaved frame(k) / frame(k + 1) pattern of the gait interpolation
+#include "arduinoStub.h"
+#include "hostTest.h"
+#include "skillCodec.h"
+
+namespace raw {
+#include "InstinctBittleESP.h"
+}
+namespace encoded {
+#include "InstinctBittleESPCompressed.h"
+}
+
+#define SKILL_NUM (sizeof(raw::progmemPointer) / sizeof(raw::progmemPointer[0]))
+
+bool sameFrame(const int8_t* a, const int8_t* b, int frameSize) {
+  return !memcmp(a, b, frameSize);
+}
+
+bool ownFrame(const FrameDecoder& d, const int8_t* f) {  // f is in the buffers of d
+  return (f >= d.buffer[0] && f < d.buffer[0] + sizeof(d.buffer)) || f == d.first;
+}
+
+int main() {
+  srand(8);
+  CHECK(SKILL_NUM == sizeof(encoded::progmemPointer) / sizeof(encoded::progmemPointer[0]));
+  FrameDecoder decoder;
+  long rawBytes = 0, encodedBytes = 0, reads = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    CHECK(!strcmp(raw::skillNameWithType[s], encoded::skillNameWithType[s]));
+    const int8_t* r = raw::progmemPointer[s];
+    const int8_t* e = encoded::progmemPointer[s];
+    int8_t period = r[0];
+    int header = period > 0 ? 4 : 7;  // Skill::dataLen()
+    int frameSize = period > 1 ? WALKING_DOF : period == 1 ? DOF : DOF + 4;
+    int frames = abs(period);
+    CHECK(!memcmp(r, e, header));  // the header is kept as it is
+    const int8_t* rawFrames = r + header;
+    decoder.begin(e + header, frameSize);
+
+    // in order, twice, so the second pass starts over from frame 0
+    for (int pass = 0; pass < 2; pass++)
+      for (int k = 0; k < frames; k++, reads++)
+        CHECK(sameFrame(decoder.frame(k), rawFrames + k * frameSize, frameSize));
+    int end = decoder.pos - e;  // the last frame ends the skill
+    encodedBytes += end;
+    rawBytes += header + frames * frameSize;
+
+    // at random
+    for (int i = 0; i < 4 * frames; i++, reads++) {
+      int k = rand() % frames;
+      CHECK(sameFrame(decoder.frame(k), rawFrames + k * frameSize, frameSize));
+    }
+
+    // frame(k) and frame(k + 1) of the interpolation, going round the gait, and a jump now and then
+    int k = rand() % frames;
+    for (int i = 0; i < 4 * frames; i++, reads += 2) {
+      int k1 = (k + 1) % frames;
+      const int8_t* a = decoder.frame(k);
+      CHECK(sameFrame(a, rawFrames + k * frameSize, frameSize));
+      const int8_t* b = decoder.frame(k1);
+      CHECK(sameFrame(b, rawFrames + k1 * frameSize, frameSize));
+      CHECK(sameFrame(a, rawFrames + k * frameSize, frameSize));  // reading k + 1 keeps frame k valid
+      k = (rand() % 8) ? k1 : rand() % frames;
+    }
+  }
+  // a copy made partway through a skill, like the outgoing gait of a crossfade (*previousGait = *skill), decodes into
+  // its own buffer: the two copies go on at different frames and both stay right
+  long copies = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    const int8_t* r = raw::progmemPointer[s];
+    int8_t period = r[0];
+    if (period < 2) continue;  // the gaits
+    const int8_t* rawFrames = r + 4;
+    decoder.begin(encoded::progmemPointer[s] + 4, WALKING_DOF);
+    int k = rand() % period;
+    decoder.frame(k);
+    FrameDecoder copy = decoder;
+    for (int i = 0; i < 2 * period; i++, copies++) {
+      int a = (k + i) % period, b = (k + 3 * i + 1) % period;
+      const int8_t* fromCopy = copy.frame(a);
+      const int8_t* fromDecoder = decoder.frame(b);
+      CHECK(ownFrame(copy, fromCopy) && ownFrame(decoder, fromDecoder));
+      CHECK(sameFrame(fromCopy, rawFrames + a * WALKING_DOF, WALKING_DOF));
+      CHECK(sameFrame(fromDecoder, rawFrames + b * WALKING_DOF, WALKING_DOF));
+      CHECK(sameFrame(copy.frame(a), rawFrames + a * WALKING_DOF, WALKING_DOF));
+    }
+  }
+  CHECK(copies > 0);
+  printf("%d skills, %ld frames read back: %ld -> %ld bytes (%.1f%%)\n", int(SKILL_NUM), reads, rawBytes, encodedBytes,
+         100.0 * encodedBytes / rawBytes);
+  CHECK(rawBytes == 22425);  // the size in the comment of InstinctBittleESP.h
+  CHECK(encodedBytes == 13744);  // and in the one of InstinctBittleESPCompressed.h
+  return testResult();
+}
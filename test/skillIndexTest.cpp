@@ -0,0 +1,115 @@
+// SkillList (skillIndex.h): every instinct name resolves to its own skill, the L/R/X keys resolve to the L version of
+// a gait or to a skill without direction, and the cost of the boot and of a lookup against the old QList scan
+#define ALLOC_COUNTER
+#define PROFILE_CORE 1
+#include <iterator>
+#include <list>
+#include "arduinoStub.h"
+#include "hostTest.h"
+
+int xPortGetCoreID() {
+  return PROFILE_CORE;
+}
+
+#include "allocCounter.h"
+#include "InstinctBittleESP.h"
+#include "skillIndex.h"
+
+// the old SkillList: a QList of heap-allocated previews, scanned with get(s), which walks the list from its head
+struct SkillPreview {
+  char* skillName;
+  int period;
+  int index;
+  SkillPreview(int s) {
+    skillName = new char[strlen(skillNameWithType[s])];
+    strcpy(skillName, skillNameWithType[s]);
+    skillName[strlen(skillNameWithType[s]) - 1] = '\0';
+    period = (int8_t)pgm_read_byte(progmemPointer[s]);
+    index = s;
+  }
+};
+struct OldSkillList : std::list<SkillPreview*> {
+  OldSkillList() {
+    for (int s = 0; s < int(SKILL_NUM); s++) push_back(new SkillPreview(s));
+  }
+  SkillPreview* get(int s) { return *std::next(begin(), s); }
+  int lookUp(const char* key) {
+    byte keyLen = strlen(key);
+    char lr = key[keyLen - 1];
+    for (int s = 0; s < int(SKILL_NUM); s++) {
+      char readName[CMD_LEN + 1];
+      strcpy(readName, get(s)->skillName);
+      byte nameLen = strlen(readName);
+      if (!strcmp(readName, key) || (readName[nameLen - 1] != 'F' && strcmp(readName, "bk") &&
+                                     !strncmp(readName, key, keyLen - 1) && (lr == 'L' || lr == 'R' || lr == 'X')))
+        return s;
+    }
+    return -1;
+  }
+};
+
+int lookUpName(SkillList* list, const char* key) {  // the index in progmemPointer, -1 if not found
+  int s = list->lookUp(key);
+  return s == -1 ? -1 : list->get(s)->index;
+}
+
+int main() {
+  char names[SKILL_NUM][CMD_LEN + 1];
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    strcpy(names[s], skillNameWithType[s]);
+    names[s][strlen(names[s]) - 1] = '\0';
+  }
+
+  ALLOC_CHECK(false);
+  double start = nowNs();
+  SkillList list;  // the firmware keeps it on the heap. here it's on the stack so the build itself is counted
+  double bootNs = nowNs() - start;
+  CHECK(allocCount == 0);
+  uint32_t allocBefore = allocCount;
+  start = nowNs();
+  OldSkillList* old = new OldSkillList();
+  double oldBootNs = nowNs() - start;
+  uint32_t oldAllocs = allocCount - allocBefore;
+
+  // the index is sorted, and every name resolves to itself
+  for (int i = 1; i < int(SKILL_NUM); i++)
+    CHECK(compareSkillName(list.get(i), list.get(i - 1)->name, list.get(i - 1)->nameLen) > 0);
+  for (int s = 0; s < int(SKILL_NUM); s++) CHECK(lookUpName(&list, names[s]) == s);
+
+  // L, R and X of a gait are built from its L version, not from a longer name that starts the same
+  int wkL = lookUpName(&list, "wkL");
+  CHECK(wkL != -1 && lookUpName(&list, "wkR") == wkL && lookUpName(&list, "wkX") == wkL);
+  CHECK(lookUpName(&list, "crR") == lookUpName(&list, "crL"));
+  CHECK(lookUpName(&list, "bkR") == lookUpName(&list, "bkL"));
+  CHECK(old->lookUp("wkR") == lookUpName(&list, "wkArmL"));  // the old scan picked the arm gait
+  // a posture or behavior has no direction
+  CHECK(lookUpName(&list, "sitR") == lookUpName(&list, "sit"));
+  CHECK(lookUpName(&list, "hiL") == lookUpName(&list, "hi"));
+  CHECK(lookUpName(&list, "nosuch") == -1);
+  CHECK(lookUpName(&list, "wkF") != lookUpName(&list, "wk"));
+
+  // the cost of looking up every name
+  const int rounds = 2000;
+  allocBefore = allocCount;
+  long sum = 0;
+  start = nowNs();
+  for (int r = 0; r < rounds; r++)
+    for (int s = 0; s < int(SKILL_NUM); s++) sum += list.lookUp(names[s]);
+  double lookUpNs = (nowNs() - start) / rounds / SKILL_NUM;
+  CHECK(allocCount == allocBefore);
+  keep(sum);
+  start = nowNs();
+  for (int r = 0; r < rounds / 10; r++)
+    for (int s = 0; s < int(SKILL_NUM); s++) sum += old->lookUp(names[s]);
+  double oldLookUpNs = (nowNs() - start) / (rounds / 10) / SKILL_NUM;
+  keep(sum);
+  printf("%d skills. boot: %.1f us and no heap, was %.1f us and %u allocations. lookup: %.1f ns, was %.0f ns\n",
+         int(SKILL_NUM), bootNs / 1000, oldBootNs / 1000, oldAllocs, lookUpNs, oldLookUpNs);
+  CHECK(oldAllocs == 3 * SKILL_NUM + 1);  // a node, a preview and a name per skill, and the list
+  for (SkillPreview* p : *old) {
+    delete[] p->skillName;
+    delete p;
+  }
+  delete old;
+  return testResult();
+}
@@ -0,0 +1,122 @@
+// The tick path of Skill::performTicks() (tickJoint(), frameTicks() and blendTicks() of dutyTable.h) against the angle
+// path of performAngles() and servoFrame() (the interpolated angle, the balance, the clamp to angleLimit and
+// angleTicks()) over every gait and posture of InstinctBittleESP.h with a random calibration: the frames give the same
+// ticks, between them the paths stay within the half degree the angle path truncates to, and the cost of a frame
+#include <math.h>
+#include "arduinoStub.h"
+#include "hostTest.h"
+#define DEFAULT_TIMER_WIDTH 16  // ESP32Servo.h
+#define SERVO_FREQ 240          // RoboDog.h
+#include "servoOutput.h"
+#include "dutyTable.h"
+#include "InstinctBittleESP.h"
+
+#define SKILL_NUM (sizeof(progmemPointer) / sizeof(progmemPointer[0]))
+#define TICK_FRAMES 128  // skill.h
+#define P1S_RANGE 290    // SERVO_P1S of espServo.h
+#define PHASES 8         // between two frames
+
+typedef DutyTable<P1S_RANGE, SERVO_FREQ, 500, 2500> dutyP1S;
+
+const int8_t middleShift[DOF] = {0, -90, 0, 0, -45, -45, -45, -45, 55, 55, -55, -55, -55, -55, -55, -55};
+const int8_t rotationDirection[DOF] = {1, -1, -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, 1, -1};
+int angleLimit[][2] = {{-120, 120}, {-85, 85}, {-120, 120}, {-120, 120}, {-90, 60},  {-90, 60},
+                       {-90, 90},   {-90, 90}, {-200, 80},  {-200, 80},  {-80, 200}, {-80, 200},
+                       {-80, 200},  {-80, 200}, {-80, 200}, {-80, 200}};
+
+const ServoTicks p1s = {P1S_RANGE, dutyP1S::tick, 0};
+int calibratedZeroPosition[DOF];
+uint16_t tickFrames[TICK_FRAMES][WALKING_DOF];
+JointTicks jointTicks[WALKING_DOF];
+
+// servoFrame() of the angle a of joint j
+int angleTicksOf(byte j, float a) {
+  a = std::max(float(angleLimit[j][0]), std::min(float(angleLimit[j][1]), a));
+  return angleTicks(p1s, calibratedZeroPosition[j], rotationDirection[j], a);
+}
+
+int main() {
+  srand(25);
+  for (int j = 0; j < DOF; j++) {
+    int calib = rand() % 21 - 10;  // servoCalib
+    calibratedZeroPosition[j] = P1S_RANGE / 2 + (middleShift[j] + calib) * rotationDirection[j];
+  }
+  int skills = 0, worstBetween = 0, worstBalance = 0;
+  long points = 0, identical = 0;
+  double angleNs = 0, tickNs = 0;
+  long frames = 0, sum = 0;
+  for (int s = 0; s < int(SKILL_NUM); s++) {
+    const int8_t* data = progmemPointer[s];
+    int period = data[0];
+    if (period < 1 || period > TICK_FRAMES) continue;  // the skills of the tick path
+    skills++;
+    int frameSize = period > 1 ? WALKING_DOF : DOF, ratio = data[3];
+    const int8_t* angles = data + 4;
+    auto angle = [&](int k, byte j) { return angles[k * frameSize + j - (DOF - frameSize)] * ratio; };
+
+    // Skill::compileTicks()
+    for (byte c = 0; c < WALKING_DOF; c++) {
+      byte j = DOF - WALKING_DOF + c;
+      jointTicks[c] = tickJoint(p1s, calibratedZeroPosition[j], rotationDirection[j], angleLimit[j]);
+    }
+    for (int k = 0; k < period; k++)
+      for (byte c = 0; c < WALKING_DOF; c++) {
+        byte j = DOF - WALKING_DOF + c;
+        tickFrames[k][c] = frameTicks(p1s, jointTicks[c], calibratedZeroPosition[j], rotationDirection[j], angle(k, j));
+      }
+
+    for (int k = 0; k < period; k++) {
+      int next = (k + 1) % period;
+      for (byte c = 0; c < WALKING_DOF; c++) {
+        byte j = DOF - WALKING_DOF + c;
+        const JointTicks& t = jointTicks[c];
+        int a = angle(k, j), b = angle(next, j);
+        points++;
+        identical += blendTicks(t, tickFrames[k][c], tickFrames[next][c], 0, 0) == angleTicksOf(j, a);
+        for (int p = 1; p < PHASES; p++) {
+          float phase = float(p) / PHASES;  // Skill::angleAt()
+          int32_t tickPhase = int32_t(phase * 256);
+          int tick = blendTicks(t, tickFrames[k][c], tickFrames[next][c], tickPhase, 0);
+          worstBetween = std::max(worstBetween, abs(tick - angleTicksOf(j, a + (b - a) * phase)));
+          float adjust = (rand() % 201 - 100) / 10.0;  // the balance
+          tick = blendTicks(t, tickFrames[k][c], tickFrames[next][c], tickPhase, adjust);
+          worstBalance = std::max(worstBalance, abs(tick - angleTicksOf(j, a + (b - a) * phase + adjust)));
+        }
+      }
+    }
+
+    // a frame of the walking joints at every phase, with the balance, each way
+    const int rounds = 200;
+    double start = nowNs();
+    for (int r = 0; r < rounds; r++)
+      for (int k = 0; k < period; k++)
+        for (byte c = 0; c < WALKING_DOF; c++) {
+          byte j = DOF - WALKING_DOF + c;
+          float phase = float(r % PHASES) / PHASES;
+          float a = angle(k, j);
+          sum += angleTicksOf(j, a + (angle((k + 1) % period, j) - a) * phase + 0.5f);
+        }
+    angleNs += nowNs() - start;
+    start = nowNs();
+    for (int r = 0; r < rounds; r++)
+      for (int k = 0; k < period; k++)
+        for (byte c = 0; c < WALKING_DOF; c++) {
+          int32_t phase = (r % PHASES) * 256 / PHASES;
+          sum += blendTicks(jointTicks[c], tickFrames[k][c], tickFrames[(k + 1) % period][c], phase, 0.5f);
+        }
+    tickNs += nowNs() - start;
+    frames += long(rounds) * period;
+  }
+  keep(sum);
+  float halfDegree = tableTicksPerDegree(p1s) / 2;
+  printf("%d gaits and postures: %ld of %ld frame points identical. between frames %d ticks apart at most, %d with "
+         "a +-10 degree balance (half a degree is %.0f ticks)\n",
+         skills, identical, points, worstBetween, worstBalance, halfDegree);
+  printf("a frame of the walking joints: %.0f ns on the angle path, %.0f ns on the tick path\n", angleNs / frames,
+         tickNs / frames);
+  CHECK(skills > 30);
+  CHECK(identical == points);
+  CHECK(worstBetween <= halfDegree + 2);
+  CHECK(worstBalance <= 2 * halfDegree);
+  return testResult();
+}
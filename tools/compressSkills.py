@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Compress the instinct skills with delta and run-length coding.
+
+Reads the raw skill arrays of src/InstinctBittleESP.h and writes src/InstinctBittleESPCompressed.h, which is used
+when COMPRESSED_SKILLS is defined in src/RoboDog.h. Every skill is decoded again and compared with the original,
+and the compression ratio is reported.
+
+The header of a skill (period, roll, pitch, angle ratio and the 3 loop bytes of a behavior) is kept as is.
+Each following frame starts with a control byte. See src/skillCodec.h for the decoder.
+    0x80 | (n - 1)  the previous frame is repeated n times (n = 1 ~ 128)
+    0x00            raw frame: frameSize bytes
+    0x40            delta frame: signed 4-bit deltas of all columns, two per byte, the first one in the low nibble
+    0x20            sparse frame: a bit mask of the changed columns (bit c % 8 of byte c / 8), then their new values
+    0x60            sparse delta frame: the bit mask, then the 4-bit deltas of the changed columns
+The decoder starts from a frame of zeros. The encoder picks the shortest form of each frame.
+
+Usage: python3 tools/compressSkills.py [src/InstinctBittleESP.h] [src/InstinctBittleESPCompressed.h]
+"""
+import os
+import re
+import sys
+
+DOF = 16
+WALKING_DOF = 8
+REPEAT = 0x80
+DELTA = 0x40
+SPARSE = 0x20
+RAW = 0x00
+
+
+def frame_size(period):
+    return WALKING_DOF if period > 1 else DOF if period == 1 else DOF + 4
+
+
+def header_len(period):
+    return 4 if period > 0 else 7
+
+
+def encode(data):
+    period = data[0]
+    head, size = header_len(period), frame_size(period)
+    frames = [data[head + k * size: head + (k + 1) * size] for k in range(abs(period))]
+    out = list(data[:head])
+    prev = [0] * size
+    k = 0
+    while k < len(frames):
+        frame = frames[k]
+        if frame == prev:
+            n = 1
+            while k + n < len(frames) and frames[k + n] == prev and n < 128:
+                n += 1
+            out.append(to_int8(REPEAT | (n - 1)))
+            k += n
+            continue
+        delta = [frame[c] - prev[c] for c in range(size)]
+        changed = [c for c in range(size) if delta[c]]
+        mask = [0] * ((size + 7) // 8)
+        for c in changed:
+            mask[c // 8] |= 1 << (c % 8)
+        mask = [to_int8(b) for b in mask]
+        small = all(-8 <= d <= 7 for d in delta)
+        forms = [[RAW] + frame, [SPARSE] + mask + [frame[c] for c in changed]]
+        if small:
+            forms.append([DELTA] + pack_nibbles(delta))
+            forms.append([SPARSE | DELTA] + mask + pack_nibbles([delta[c] for c in changed]))
+        out.extend(min(forms, key=len))
+        prev = frame
+        k += 1
+    return out
+
+
+def pack_nibbles(values):
+    if len(values) % 2:
+        values = values + [0]
+    return [to_int8((values[i] & 0x0F) | ((values[i + 1] & 0x0F) << 4)) for i in range(0, len(values), 2)]
+
+
+def to_int8(b):
+    return b - 256 if b > 127 else b
+
+
+def nibble(b):
+    return b - 16 if b > 7 else b
+
+
+def decode(code):
+    period = code[0]
+    head, size = header_len(period), frame_size(period)
+    out = list(code[:head])
+    row = [0] * size
+    pos = head
+    while len(out) < head + abs(period) * size:
+        c = code[pos] & 0xFF
+        pos += 1
+        if c & REPEAT:
+            out.extend(row * ((c & 0x7F) + 1))
+            continue
+        columns = range(size)
+        if c & SPARSE:
+            mask = [b & 0xFF for b in code[pos:pos + (size + 7) // 8]]
+            pos += len(mask)
+            columns = [col for col in range(size) if mask[col // 8] >> (col % 8) & 1]
+        if c & DELTA:
+            for i, col in enumerate(columns):
+                b = code[pos + i // 2] & 0xFF
+                row[col] += nibble(b >> 4 if i % 2 else b & 0x0F)
+            pos += (len(columns) + 1) // 2
+        else:
+            for i, col in enumerate(columns):
+                row[col] = code[pos + i]
+            pos += len(columns)
+        out.extend(row)
+    return out, pos
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    source = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'src', 'InstinctBittleESP.h')
+    target = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'src', 'InstinctBittleESPCompressed.h')
+    text = open(source).read()
+    arrays = re.findall(r'const int8_t (\w+)\[\] PROGMEM = \{(.*?)\};', text, re.S)
+    tail = text[text.index('const char* skillNameWithType[]'):]
+
+    lines = ['// Generated by tools/compressSkills.py from %s. Do not edit.' % os.path.basename(source),
+             '// number of skills: %d' % len(arrays), '']
+    raw_total = code_total = 0
+    for name, body in arrays:
+        data = [int(v) for v in re.findall(r'-?\d+', body)]
+        code = encode(data)
+        decoded, used = decode(code)
+        if decoded != data or used != len(code):
+            sys.exit('round trip failed for %s' % name)
+        raw_total += len(data)
+        code_total += len(code)
+        lines.append('const int8_t %s[] PROGMEM = {  // %d -> %d bytes' % (name, len(data), len(code)))
+        for i in range(0, len(code), 20):
+            lines.append('  ' + ', '.join('%d' % v for v in code[i:i + 20]) + ',')
+        lines.append('};')
+    lines.append(tail.replace('// the total byte of instincts is', '// the total byte of the raw instincts is'))
+    lines.insert(2, '// %d -> %d bytes (%.1f%%)' % (raw_total, code_total, 100.0 * code_total / raw_total))
+    open(target, 'w').write('\n'.join(lines))
+    print('%d skills passed the round trip. %d -> %d bytes (%.1f%%)' %
+          (len(arrays), raw_total, code_total, 100.0 * code_total / raw_total))
+
+
+if __name__ == '__main__':
+    main()